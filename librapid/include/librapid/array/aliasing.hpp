@@ -0,0 +1,137 @@
+#ifndef LIBRAPID_ARRAY_ALIASING_HPP
+#define LIBRAPID_ARRAY_ALIASING_HPP
+
+/*
+ * Detecting when the destination of an assignment is also read by the expression being assigned.
+ * Element-wise expressions can safely overwrite their operands (each element is read before it is
+ * written), but matrix multiplications, broadcast views and reallocations cannot, so these
+ * evaluate into a temporary first when the memory overlaps.
+ */
+
+namespace librapid::detail {
+	/// A range of memory, in bytes
+	struct MemoryRange {
+		const char *begin = nullptr;
+		const char *end	  = nullptr;
+
+		/// Return true if this range shares at least one byte with \p other
+		/// \param other The range to compare with
+		/// \return True if the ranges overlap
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool overlaps(const MemoryRange &other) const {
+			return begin < other.end && other.begin < end;
+		}
+	};
+
+	/// Return the memory used by a storage object
+	/// \tparam StorageType The type of the storage object
+	/// \param storage The storage object
+	/// \return The range of memory holding its elements
+	template<typename StorageType>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE MemoryRange storageRange(const StorageType &storage) {
+		using Scalar = typename StorageType::Scalar;
+		const Scalar *begin;
+		if constexpr (std::is_same_v<typename typetraits::TypeInfo<StorageType>::Device,
+									 device::GPU>) {
+			begin = storage.begin().get();
+		} else {
+			begin = storage.begin();
+		}
+		const auto *data = reinterpret_cast<const char *>(begin);
+		return {data, data + storage.size() * sizeof(Scalar)};
+	}
+
+	/// Return true if an expression reads any memory in \p range. Every array the expression
+	/// refers to is checked, including those behind views, transpositions and products, so a
+	/// false result guarantees that writing to \p range cannot change the value of the
+	/// expression. Scalars never alias.
+	/// \tparam T The type of the expression
+	/// \param expr The expression
+	/// \param range The memory being written to
+	/// \return True if the expression may read from \p range
+	template<typename T>
+	LIBRAPID_NODISCARD bool mayAlias(const T &expr, const MemoryRange &range);
+
+	template<typename ShapeType_, typename StorageType_>
+	LIBRAPID_NODISCARD bool mayAlias(const array::ArrayContainer<ShapeType_, StorageType_> &array,
+									 const MemoryRange &range);
+
+	template<typename T>
+	LIBRAPID_NODISCARD bool mayAlias(const array::ArrayView<T> &view, const MemoryRange &range);
+
+	template<typename desc, typename Functor_, typename... Args>
+	LIBRAPID_NODISCARD bool mayAlias(const Function<desc, Functor_, Args...> &function,
+									 const MemoryRange &range);
+
+	template<typename T>
+	bool mayAlias(const T &, const MemoryRange &) {
+		return false;
+	}
+
+	template<typename ShapeType_, typename StorageType_>
+	bool mayAlias(const array::ArrayContainer<ShapeType_, StorageType_> &array,
+				  const MemoryRange &range) {
+		return storageRange(array.storage()).overlaps(range);
+	}
+
+	template<typename T>
+	bool mayAlias(const array::ArrayView<T> &view, const MemoryRange &range) {
+		return mayAlias(view.ref(), range);
+	}
+
+	template<typename desc, typename Functor_, typename... Args>
+	bool mayAlias(const Function<desc, Functor_, Args...> &function, const MemoryRange &range) {
+		return std::apply(
+		  [&range](const auto &...args) { return (mayAlias(args, range) || ...); },
+		  function.args());
+	}
+
+	/// Return true if an element-wise expression can be written into \p range as it is
+	/// evaluated, one element at a time. This holds when every array it reads either does not
+	/// overlap \p range, or is the destination itself read element for element (as in
+	/// a += b * a). Anything else which overlaps -- a row broadcast from the destination, a
+	/// transposition of it, or a matrix product -- may read elements which have already been
+	/// overwritten.
+	/// \tparam T The type of the expression
+	/// \tparam ShapeType The shape type of the destination
+	/// \param expr The expression
+	/// \param range The memory of the destination
+	/// \param shape The shape of the destination
+	/// \return True if the result can be written in place
+	template<typename T, typename ShapeType>
+	LIBRAPID_NODISCARD bool readsInPlace(const T &expr, const MemoryRange &range,
+										 const ShapeType &shape);
+
+	template<typename ShapeType_, typename StorageType_, typename ShapeType>
+	LIBRAPID_NODISCARD bool
+	readsInPlace(const array::ArrayContainer<ShapeType_, StorageType_> &array,
+				 const MemoryRange &range, const ShapeType &shape);
+
+	template<typename Functor_, typename... Args, typename ShapeType>
+	LIBRAPID_NODISCARD bool
+	readsInPlace(const Function<descriptor::Trivial, Functor_, Args...> &function,
+				 const MemoryRange &range, const ShapeType &shape);
+
+	template<typename T, typename ShapeType>
+	bool readsInPlace(const T &expr, const MemoryRange &range, const ShapeType &) {
+		return !mayAlias(expr, range);
+	}
+
+	template<typename ShapeType_, typename StorageType_, typename ShapeType>
+	bool readsInPlace(const array::ArrayContainer<ShapeType_, StorageType_> &array,
+					  const MemoryRange &range, const ShapeType &shape) {
+		const MemoryRange memory = storageRange(array.storage());
+		if (!memory.overlaps(range)) return true;
+		return memory.begin == range.begin && memory.end == range.end &&
+			   ShapeType(array.shape()) == shape;
+	}
+
+	template<typename Functor_, typename... Args, typename ShapeType>
+	bool readsInPlace(const Function<descriptor::Trivial, Functor_, Args...> &function,
+					  const MemoryRange &range, const ShapeType &shape) {
+		return std::apply(
+		  [&](const auto &...args) { return (readsInPlace(args, range, shape) && ...); },
+		  function.args());
+	}
+} // namespace librapid::detail
+
+#endif // LIBRAPID_ARRAY_ALIASING_HPP
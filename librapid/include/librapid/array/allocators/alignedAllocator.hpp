@@ -0,0 +1,116 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATORS_ALIGNED_ALLOCATOR_HPP
+#define LIBRAPID_ARRAY_ALLOCATORS_ALIGNED_ALLOCATOR_HPP
+
+namespace librapid {
+	/// A standard-conforming allocator which returns memory aligned to at least \p Alignment
+	/// bytes. This is the default allocator for Storage, so the first element of every array is
+	/// aligned for the widest SIMD registers and never shares a cache line with another
+	/// allocation. See LIBRAPID_MEM_ALIGN. Large allocations can also be backed by huge pages
+	/// (see global::hugePageMode).
+	/// \tparam T The type of the elements to allocate
+	/// \tparam Alignment The alignment of each allocation, in bytes (a power of two)
+	template<typename T, size_t Alignment = LIBRAPID_MEM_ALIGN>
+	class AlignedAllocator {
+	public:
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+
+		using value_type	  = T;
+		using pointer		  = T *;
+		using const_pointer	  = const T *;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+		/// The alignment of each allocation, in bytes
+		static constexpr size_t alignment = Alignment > alignof(T) ? Alignment : alignof(T);
+
+		template<typename U>
+		struct rebind {
+			using other = AlignedAllocator<U, Alignment>;
+		};
+
+		AlignedAllocator() noexcept = default;
+
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+		/// Allocate uninitialized memory for \p n elements, aligned to `alignment` bytes
+		/// \param n The number of elements to allocate
+		/// \return A pointer to the allocated memory
+		LIBRAPID_NODISCARD T *allocate(size_t n) {
+			if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			const size_t bytes = n * sizeof(T);
+			if (global::hugePageMode != HugePageMode::None && alignment <= hugePages::pageSize &&
+				bytes >= hugePages::pageSize &&
+				static_cast<int64_t>(bytes) >= global::hugePageThreshold) {
+				return static_cast<T *>(
+				  hugePages::detail::allocate(bytes, global::hugePageMode, alignment));
+			}
+			return static_cast<T *>(::operator new(bytes, std::align_val_t(alignment)));
+		}
+
+		/// Free memory returned by allocate()
+		/// \param ptr The pointer to free
+		/// \param n The number of elements \p ptr was allocated with
+		void deallocate(T *ptr, size_t n) noexcept {
+			// Huge page allocations are never smaller than a huge page, so only large blocks
+			// need to be looked up
+			const size_t bytes = n * sizeof(T);
+			if (bytes >= hugePages::pageSize) {
+				hugePages::detail::deallocate(ptr, bytes, alignment);
+			} else {
+				::operator delete(ptr, bytes, std::align_val_t(alignment));
+			}
+		}
+	};
+
+	template<typename T, typename U, size_t Alignment>
+	constexpr bool operator==(const AlignedAllocator<T, Alignment> &,
+							  const AlignedAllocator<U, Alignment> &) noexcept {
+		return true;
+	}
+
+	template<typename T, typename U, size_t Alignment>
+	constexpr bool operator!=(const AlignedAllocator<T, Alignment> &,
+							  const AlignedAllocator<U, Alignment> &) noexcept {
+		return false;
+	}
+
+	namespace detail {
+		/// Returns true if \p ptr is aligned to \p alignment bytes
+		/// \param ptr The pointer to check
+		/// \param alignment The alignment, in bytes (a power of two)
+		/// \return True if \p ptr is aligned
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isAligned(const void *ptr,
+																 size_t alignment) noexcept {
+			return (reinterpret_cast<uintptr_t>(ptr) & (alignment - 1)) == 0;
+		}
+
+		/// Returns the number of elements to process with scalar operations before \p ptr is
+		/// aligned for a full Packet of \p Scalar, so that the remaining elements can be stored
+		/// with aligned instructions. \p ptr must be aligned to sizeof(Scalar), which is always
+		/// the case for the vectorisable (arithmetic) types. The result is clamped to \p size.
+		/// \tparam Scalar The scalar type
+		/// \param ptr The first element
+		/// \param size The number of elements
+		/// \return The number of elements before the first Packet-aligned element
+		template<typename Scalar>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t alignedHead(const Scalar *ptr,
+																	   int64_t size) noexcept {
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr int64_t packetBytes = packetWidth * static_cast<int64_t>(sizeof(Scalar));
+			if constexpr (packetWidth < 2 || (packetBytes & (packetBytes - 1)) != 0) {
+				return 0;
+			} else {
+				const auto offset = static_cast<int64_t>(reinterpret_cast<uintptr_t>(ptr) &
+														 static_cast<uintptr_t>(packetBytes - 1));
+				if (offset == 0) return 0;
+				const int64_t head = (packetBytes - offset) / static_cast<int64_t>(sizeof(Scalar));
+				return std::min(head, size);
+			}
+		}
+	} // namespace detail
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ALLOCATORS_ALIGNED_ALLOCATOR_HPP
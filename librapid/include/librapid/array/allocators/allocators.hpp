@@ -0,0 +1,10 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATORS
+#define LIBRAPID_ARRAY_ALLOCATORS
+
+#include "hugePageAllocator.hpp"
+#include "alignedAllocator.hpp"
+#include "cachingAllocator.hpp"
+#include "numaAllocator.hpp"
+#include "mmapAllocator.hpp"
+
+#endif // LIBRAPID_ARRAY_ALLOCATORS
@@ -0,0 +1,135 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATORS_CACHING_ALLOCATOR_HPP
+#define LIBRAPID_ARRAY_ALLOCATORS_CACHING_ALLOCATOR_HPP
+
+/*
+ * A caching memory pool for array storage. Freed blocks are kept in size-bucketed free lists
+ * (one set per thread, plus a shared set for blocks which outlive their thread), so repeatedly
+ * creating and destroying temporaries of the same size does not go back to the system
+ * allocator, and does not page-fault in fresh memory each time.
+ */
+
+namespace librapid {
+	namespace memoryPool {
+		/// Statistics for the memory pool used by CachingAllocator. All sizes are in bytes,
+		/// after rounding up to the size of a pool block.
+		struct Stats {
+			int64_t allocations		= 0; // Number of allocations made through the pool
+			int64_t cacheHits		= 0; // Allocations served from a free list
+			int64_t bytesInUse		= 0; // Bytes in blocks currently handed out by the pool
+			int64_t peakBytesInUse	= 0; // Largest value of bytesInUse so far
+			int64_t bytesCached		= 0; // Bytes in free blocks waiting to be reused
+			int64_t bytesFromSystem = 0; // Bytes currently allocated from the system
+		};
+
+		/// Return a snapshot of the memory pool's statistics
+		/// \return The current statistics
+		LIBRAPID_NODISCARD Stats stats();
+
+		/// Reset the counters of the memory pool (allocations, cacheHits and peakBytesInUse).
+		/// The byte counts which describe the current state of the pool are unaffected.
+		void resetStats();
+
+		/// Return every free block in the calling thread's cache and the shared cache to the
+		/// system. Blocks cached by other threads are released when those threads exit, or when
+		/// they call trim() themselves. With CUDA, memory cached by the device's memory pool is
+		/// also released.
+		void trim();
+
+		/// While an Arena exists, every block freed by the owning thread is kept in that
+		/// thread's cache, regardless of global::memoryPoolCacheSize, so a batch of operations
+		/// can reuse its temporaries without any calls to the system allocator. When the
+		/// outermost Arena is destroyed, the thread's cache is trimmed back down to
+		/// global::memoryPoolCacheSize. Arenas can be nested.
+		class Arena {
+		public:
+			Arena();
+			Arena(const Arena &)			= delete;
+			Arena &operator=(const Arena &) = delete;
+			~Arena();
+		};
+
+		namespace detail {
+			/// Allocate a block of at least \p bytes bytes, aligned to LIBRAPID_MEM_ALIGN
+			/// \param bytes The number of bytes required
+			/// \return A pointer to the block
+			LIBRAPID_NODISCARD void *allocate(size_t bytes);
+
+			/// Return a block from allocate() to the pool
+			/// \param ptr The pointer returned by allocate()
+			/// \param bytes The number of bytes passed to allocate()
+			void deallocate(void *ptr, size_t bytes) noexcept;
+
+#if defined(LIBRAPID_HAS_CUDA)
+			/// CudaStorage allocates with cudaMallocAsync, which takes memory from the device's
+			/// default memory pool. Unless it is told otherwise, that pool returns freed memory
+			/// to the driver whenever the device synchronises. On its first call, this sets the
+			/// pool to keep up to global::memoryPoolCacheSize bytes of freed memory, so device
+			/// temporaries are reused as host ones are. Later calls do nothing.
+			void retainDeviceMemory();
+#endif // LIBRAPID_HAS_CUDA
+		} // namespace detail
+	}	  // namespace memoryPool
+
+	/// A standard-conforming allocator which takes its memory from a caching pool, rather than
+	/// from the system allocator each time. Allocations are rounded up to one of a small number
+	/// of block sizes per power of two, and freed blocks are cached in thread-local free lists
+	/// to be reused by later allocations of the same size class. Memory is aligned to
+	/// LIBRAPID_MEM_ALIGN bytes, exactly as with AlignedAllocator.
+	///
+	/// Use it as the allocator of a Storage object -- for example
+	/// `Array<float, Storage<float, CachingAllocator<float>>>`. See memoryPool::stats(),
+	/// memoryPool::trim() and memoryPool::Arena.
+	/// \tparam T The type of the elements to allocate
+	template<typename T>
+	class CachingAllocator {
+	public:
+		static_assert(alignof(T) <= LIBRAPID_MEM_ALIGN,
+					  "CachingAllocator cannot allocate types with alignment greater than "
+					  "LIBRAPID_MEM_ALIGN");
+
+		using value_type	  = T;
+		using pointer		  = T *;
+		using const_pointer	  = const T *;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+		template<typename U>
+		struct rebind {
+			using other = CachingAllocator<U>;
+		};
+
+		CachingAllocator() noexcept = default;
+
+		template<typename U>
+		CachingAllocator(const CachingAllocator<U> &) noexcept {}
+
+		/// Allocate uninitialized memory for \p n elements
+		/// \param n The number of elements to allocate
+		/// \return A pointer to the allocated memory
+		LIBRAPID_NODISCARD T *allocate(size_t n) {
+			if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<T *>(memoryPool::detail::allocate(n * sizeof(T)));
+		}
+
+		/// Return memory from allocate() to the pool
+		/// \param ptr The pointer to free
+		/// \param n The number of elements \p ptr was allocated with
+		void deallocate(T *ptr, size_t n) noexcept {
+			memoryPool::detail::deallocate(ptr, n * sizeof(T));
+		}
+	};
+
+	template<typename T, typename U>
+	constexpr bool operator==(const CachingAllocator<T> &, const CachingAllocator<U> &) noexcept {
+		return true;
+	}
+
+	template<typename T, typename U>
+	constexpr bool operator!=(const CachingAllocator<T> &, const CachingAllocator<U> &) noexcept {
+		return false;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ALLOCATORS_CACHING_ALLOCATOR_HPP
@@ -0,0 +1,112 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HPP
+#define LIBRAPID_ARRAY_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HPP
+
+/*
+ * Huge-page backed allocation. With 4 KiB pages, random access over a multi-GB array misses in
+ * the TLB on almost every access. Backing the array with 2 MiB pages lets the TLB cover 512
+ * times as much memory. Huge pages are only supported on Linux -- elsewhere, these functions
+ * fall back to ordinary aligned allocations.
+ */
+
+namespace librapid {
+	namespace hugePages {
+		/// The size of a huge page, in bytes
+		constexpr size_t pageSize = 2 * 1024 * 1024;
+
+		/// Return the number of bytes of an allocation which are actually backed by huge pages.
+		/// Explicit huge pages are always fully backed. Transparent huge pages are only
+		/// reported once the memory has been touched, and only if the kernel was able to
+		/// provide them.
+		/// \param ptr A pointer returned by HugePageAllocator or (with global::hugePageMode
+		/// set) AlignedAllocator
+		/// \return The number of bytes backed by huge pages, or 0 if \p ptr is not a huge page
+		/// allocation
+		LIBRAPID_NODISCARD int64_t hugePageBytes(const void *ptr);
+
+		namespace detail {
+			/// Allocate \p bytes bytes (rounded up to a whole number of huge pages) using the
+			/// huge page mode \p mode. Allocations smaller than a huge page are made with the
+			/// system allocator instead.
+			/// \param bytes The number of bytes to allocate
+			/// \param mode The type of huge pages to request
+			/// \param alignment The alignment of the memory, in bytes (at most pageSize)
+			/// \return A pointer to the memory, aligned to at least \p alignment bytes
+			LIBRAPID_NODISCARD void *allocate(size_t bytes, HugePageMode mode,
+											  size_t alignment = LIBRAPID_MEM_ALIGN);
+
+			/// Free memory returned by allocate()
+			/// \param ptr The pointer to free
+			/// \param bytes The number of bytes passed to allocate()
+			/// \param alignment The alignment passed to allocate()
+			void deallocate(void *ptr, size_t bytes,
+							size_t alignment = LIBRAPID_MEM_ALIGN) noexcept;
+
+			/// Free \p ptr if it was mapped by allocate()
+			/// \param ptr The pointer to free
+			/// \return True if \p ptr was a huge page allocation, and has been freed
+			bool release(void *ptr) noexcept;
+		} // namespace detail
+	}	  // namespace hugePages
+
+	/// A standard-conforming allocator which backs every allocation of at least one huge page
+	/// (2 MiB) with huge pages. Use this to select huge pages for a single array -- for example
+	/// `Array<double, Storage<double, HugePageAllocator<double>>>`. To use huge pages for all
+	/// large arrays, set global::hugePageMode instead. See hugePages::hugePageBytes() to check
+	/// whether huge pages were obtained.
+	/// \tparam T The type of the elements to allocate
+	/// \tparam mode The type of huge pages to request
+	template<typename T, HugePageMode mode = HugePageMode::Transparent>
+	class HugePageAllocator {
+	public:
+		static_assert(alignof(T) <= LIBRAPID_MEM_ALIGN,
+					  "HugePageAllocator cannot allocate types with alignment greater than "
+					  "LIBRAPID_MEM_ALIGN");
+
+		using value_type	  = T;
+		using pointer		  = T *;
+		using const_pointer	  = const T *;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+		template<typename U>
+		struct rebind {
+			using other = HugePageAllocator<U, mode>;
+		};
+
+		HugePageAllocator() noexcept = default;
+
+		template<typename U>
+		HugePageAllocator(const HugePageAllocator<U, mode> &) noexcept {}
+
+		/// Allocate uninitialized memory for \p n elements
+		/// \param n The number of elements to allocate
+		/// \return A pointer to the allocated memory
+		LIBRAPID_NODISCARD T *allocate(size_t n) {
+			if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			return static_cast<T *>(hugePages::detail::allocate(n * sizeof(T), mode));
+		}
+
+		/// Free memory returned by allocate()
+		/// \param ptr The pointer to free
+		/// \param n The number of elements \p ptr was allocated with
+		void deallocate(T *ptr, size_t n) noexcept {
+			hugePages::detail::deallocate(ptr, n * sizeof(T));
+		}
+	};
+
+	template<typename T, typename U, HugePageMode mode>
+	constexpr bool operator==(const HugePageAllocator<T, mode> &,
+							  const HugePageAllocator<U, mode> &) noexcept {
+		return true;
+	}
+
+	template<typename T, typename U, HugePageMode mode>
+	constexpr bool operator!=(const HugePageAllocator<T, mode> &,
+							  const HugePageAllocator<U, mode> &) noexcept {
+		return false;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ALLOCATORS_HUGE_PAGE_ALLOCATOR_HPP
@@ -0,0 +1,184 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATORS_MMAP_ALLOCATOR_HPP
+#define LIBRAPID_ARRAY_ALLOCATORS_MMAP_ALLOCATOR_HPP
+
+/*
+ * File-backed array storage. An MmapAllocator maps a file into memory instead of allocating,
+ * so a Storage using it is backed directly by the file, and arrays far larger than RAM can be
+ * processed by the normal lazy evaluation machinery -- the operating system pages the data in
+ * and out as it is used. Only supported on POSIX systems.
+ */
+
+namespace librapid {
+	/// How a file is mapped by MmapAllocator
+	enum class MmapMode {
+		ReadOnly,	 // The array cannot be written to
+		ReadWrite,	 // Writes go to the file, which is created or extended as required
+		CopyOnWrite, // Writes are private to the process, and are never written to the file
+	};
+
+	/// Access pattern hints passed to madvise() for a mapped file
+	enum class MmapAdvice {
+		Normal,		// No special treatment
+		Sequential, // Read ahead aggressively, and free pages soon after they are read
+		Random,		// Do not read ahead
+		WillNeed,	// Start reading the whole mapping in immediately
+	};
+
+	namespace detail {
+		/// An open file, and the options it is mapped with. Defined in mmap.cpp
+		class MappedFile;
+
+		/// Open a file to be mapped
+		/// \param path The path of the file
+		/// \param mode How the file is mapped
+		/// \param advice The access pattern hint for the mapping
+		/// \param offset The offset (in bytes) within the file of the first element
+		/// \return The opened file
+		LIBRAPID_NODISCARD std::shared_ptr<MappedFile>
+		openMappedFile(const std::string &path, MmapMode mode, MmapAdvice advice, size_t offset);
+
+		/// Map \p bytes bytes of \p file, starting at its offset
+		/// \param file The file to map
+		/// \param bytes The number of bytes to map
+		/// \return A pointer to the first byte
+		LIBRAPID_NODISCARD void *mapFile(MappedFile &file, size_t bytes);
+
+		/// Unmap memory returned by mapFile()
+		/// \param ptr The pointer to unmap
+		/// \return True if \p ptr was returned by mapFile() and has been unmapped
+		bool unmapFile(void *ptr) noexcept;
+
+		/// Ask the operating system to start reading the pages which hold a range of a mapped
+		/// file in the background. Does nothing if the range is not within memory returned by
+		/// mapFile().
+		/// \param ptr The start of the range
+		/// \param bytes The length of the range, in bytes
+		void prefetchMappedRange(const void *ptr, size_t bytes) noexcept;
+
+		/// Remove the pages which hold a range of a mapped file from the resident set of the
+		/// process. The data is not lost -- it is read back from the file if it is used again.
+		/// Does nothing for copy-on-write mappings, or if the range is not within memory
+		/// returned by mapFile().
+		/// \param ptr The start of the range
+		/// \param bytes The length of the range, in bytes
+		void releaseMappedRange(const void *ptr, size_t bytes) noexcept;
+
+		/// Return the number of bytes in \p file after its offset
+		/// \param file The file
+		/// \return The number of bytes available to map
+		LIBRAPID_NODISCARD size_t mappedFileBytes(const MappedFile &file);
+	} // namespace detail
+
+	/// A standard-conforming allocator which maps a file into memory, rather than allocating.
+	/// A default-constructed MmapAllocator (which is also what copies of a mapped Storage
+	/// receive) allocates ordinary memory, exactly as AlignedAllocator does.
+	///
+	/// Writing to a Storage mapped with MmapMode::ReadOnly is undefined behaviour (and will
+	/// usually crash). See mapArray() for the simplest way to create a file-backed array.
+	/// \tparam T The type of the elements, which must be trivially copyable
+	template<typename T>
+	class MmapAllocator {
+	public:
+		static_assert(std::is_trivially_copyable_v<T>,
+					  "Only trivially copyable types can be backed by a file");
+
+		using value_type	  = T;
+		using pointer		  = T *;
+		using const_pointer	  = const T *;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+		template<typename U>
+		struct rebind {
+			using other = MmapAllocator<U>;
+		};
+
+		/// Create an allocator which allocates ordinary memory
+		MmapAllocator() noexcept = default;
+
+		/// Create an allocator which maps the file at \p path
+		/// \param path The path of the file
+		/// \param mode How the file is mapped
+		/// \param advice The access pattern hint for the mapping
+		/// \param offset The offset (in bytes) within the file of the first element, which must be
+		/// a multiple of alignof(T)
+		/// \throws std::runtime_error if \p offset would leave the elements misaligned
+		explicit MmapAllocator(const std::string &path, MmapMode mode = MmapMode::ReadOnly,
+							   MmapAdvice advice = MmapAdvice::Normal, size_t offset = 0) :
+				m_file(detail::openMappedFile(path, mode, advice, checkOffset(path, offset))) {}
+
+		template<typename U>
+		MmapAllocator(const MmapAllocator<U> &other) noexcept : m_file(other.m_file) {}
+
+		/// Copies of a file-backed Storage are held in memory, not in the file
+		/// \return A default-constructed MmapAllocator
+		MmapAllocator select_on_container_copy_construction() const noexcept { return {}; }
+
+		/// Map the file (or allocate memory) for \p n elements
+		/// \param n The number of elements
+		/// \return A pointer to the first element
+		LIBRAPID_NODISCARD T *allocate(size_t n) {
+			if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+			if (!m_file) return AlignedAllocator<T>().allocate(n);
+			return static_cast<T *>(detail::mapFile(*m_file, n * sizeof(T)));
+		}
+
+		/// Unmap (or free) memory returned by allocate()
+		/// \param ptr The pointer to free
+		/// \param n The number of elements \p ptr was allocated with
+		void deallocate(T *ptr, size_t n) noexcept {
+			// Mappings are looked up by address, so memory is always released correctly, even
+			// if the allocator of a Storage is replaced
+			if (ptr == nullptr || detail::unmapFile(ptr)) return;
+			AlignedAllocator<T>().deallocate(ptr, n);
+		}
+
+		/// Return the number of elements of type T in the file after its offset, or 0 if this
+		/// allocator does not map a file
+		/// \return The number of elements
+		LIBRAPID_NODISCARD size_t fileElements() const {
+			return m_file ? detail::mappedFileBytes(*m_file) / sizeof(T) : 0;
+		}
+
+		template<typename U>
+		bool operator==(const MmapAllocator<U> &other) const noexcept {
+			return m_file == other.m_file;
+		}
+
+		template<typename U>
+		bool operator!=(const MmapAllocator<U> &other) const noexcept {
+			return m_file != other.m_file;
+		}
+
+	private:
+		template<typename U>
+		friend class MmapAllocator;
+
+		/// Mappings always start on a page boundary, so the elements are aligned exactly when
+		/// their offset is
+		/// \param path The path of the file, used in the error message
+		/// \param offset The offset (in bytes) within the file of the first element
+		/// \return \p offset
+		static size_t checkOffset(const std::string &path, size_t offset) {
+			if (offset % alignof(T) != 0) {
+				throw std::runtime_error(fmt::format(
+				  "Cannot map \"{}\" at offset {}: the offset must be a multiple of {} bytes",
+				  path,
+				  offset,
+				  alignof(T)));
+			}
+			return offset;
+		}
+
+		std::shared_ptr<detail::MappedFile> m_file;
+	};
+
+	/// A Storage object which can be backed by a memory-mapped file
+	/// \tparam Scalar The type of the elements
+	template<typename Scalar>
+	using MmapStorage = Storage<Scalar, MmapAllocator<Scalar>>;
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ALLOCATORS_MMAP_ALLOCATOR_HPP
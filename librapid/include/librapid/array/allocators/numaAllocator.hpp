@@ -0,0 +1,188 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATORS_NUMA_ALLOCATOR_HPP
+#define LIBRAPID_ARRAY_ALLOCATORS_NUMA_ALLOCATOR_HPP
+
+/*
+ * NUMA-aware allocation. Operating systems place a page on the NUMA node of the thread which
+ * first writes to it, so an array which is filled by one thread ends up entirely on that
+ * thread's node, and a multithreaded kernel over it is limited to the bandwidth of one socket.
+ * NumaAllocator instead touches each page from the thread which will later process it, or
+ * interleaves the pages across every node.
+ */
+
+namespace librapid {
+	namespace numa {
+		/// How the pages of a NumaAllocator allocation are placed
+		enum class Policy {
+			/// Each page is first touched by the thread which detail::assignParallel will later
+			/// use for the elements in it, so it is placed on that thread's node
+			FirstTouch,
+
+			/// Pages are interleaved across all nodes (via mbind), which gives an even spread of
+			/// bandwidth for access patterns which do not follow the static partition. Falls back
+			/// to FirstTouch if the memory policy cannot be set
+			Interleave
+		};
+
+		/// A NUMA node and the CPUs which belong to it
+		struct Node {
+			int64_t id;				   // The operating system's ID for the node
+			std::vector<int64_t> cpus; // The IDs of the CPUs in the node
+		};
+
+		/// The NUMA nodes of the machine
+		struct Topology {
+			std::vector<Node> nodes;
+
+			/// Return the number of NUMA nodes
+			/// \return The number of nodes
+			LIBRAPID_NODISCARD int64_t numNodes() const {
+				return static_cast<int64_t>(nodes.size());
+			}
+		};
+
+		/// Query the operating system for the machine's NUMA topology. Systems without NUMA
+		/// support report a single node containing every CPU.
+		/// \return The detected topology
+		LIBRAPID_NODISCARD Topology detectTopology();
+
+		/// Return the topology used by LibRapid. This is detected on first use, but it can be
+		/// replaced with setTopology() (for example, to test NUMA placement on a machine with a
+		/// single node).
+		/// \return The topology in use
+		LIBRAPID_NODISCARD const Topology &topology();
+
+		/// Replace the topology used by LibRapid
+		/// \param topology The new topology
+		void setTopology(const Topology &topology);
+
+		/// Return the index (into topology().nodes) of the node on which thread \p thread of
+		/// \p numThreads runs when bindThreads() is used. Threads are assigned to nodes in
+		/// contiguous blocks, so the static partition of an array across threads is also a
+		/// contiguous partition across nodes.
+		/// \param thread The thread number
+		/// \param numThreads The number of threads
+		/// \return The index of the node
+		LIBRAPID_NODISCARD int64_t threadNode(int64_t thread, int64_t numThreads);
+
+		/// Pin each of the global::numThreads OpenMP threads to the CPUs of its node (see
+		/// threadNode()), so threads stay on the node which holds the pages they first touched.
+		/// \return True if every thread was pinned
+		bool bindThreads();
+
+		namespace detail {
+			/// Allocate \p bytes bytes of memory which no other allocation shares a page with.
+			/// On Linux, allocations of at least one page are mapped directly with mmap, so
+			/// their pages have never been touched, and changing their memory policy cannot
+			/// affect any other allocation. Other allocations use the system allocator.
+			/// \param bytes The number of bytes to allocate
+			/// \param alignment The alignment of the memory, in bytes (at most 4096 for the memory
+			/// to be mapped)
+			/// \return A pointer to the memory
+			LIBRAPID_NODISCARD void *allocate(size_t bytes, size_t alignment);
+
+			/// Free memory returned by allocate()
+			/// \param ptr The pointer to free
+			/// \param bytes The number of bytes passed to allocate()
+			/// \param alignment The alignment passed to allocate()
+			void deallocate(void *ptr, size_t bytes, size_t alignment) noexcept;
+
+			/// Touch every page of [\p ptr, \p ptr + \p bytes) from the thread which will process
+			/// it, using the same static partition of elements as detail::assignParallel
+			/// \param ptr The start of the memory
+			/// \param bytes The size of the memory
+			/// \param elementSize The size of each array element
+			/// \param touchedBy If not null, the OpenMP thread number which touched each 4 KiB
+			/// page is written to touchedBy[page]
+			void firstTouch(void *ptr, size_t bytes, size_t elementSize,
+							int64_t *touchedBy = nullptr);
+
+			/// Set the memory policy of [\p ptr, \p ptr + \p bytes) to interleave pages across
+			/// every node in topology(). The memory must not have been touched yet.
+			/// \param ptr The start of the memory (aligned to a page)
+			/// \param bytes The size of the memory
+			/// \return True if the policy was applied
+			bool interleave(void *ptr, size_t bytes);
+
+			/// Return the ID of the node holding the page which contains \p ptr
+			/// \param ptr An address within the page, which must have been touched
+			/// \return The node ID, or -1 if it cannot be determined
+			LIBRAPID_NODISCARD int64_t pageNode(const void *ptr);
+
+			/// Return the IDs of the nodes which the memory policy of the page containing
+			/// \p ptr interleaves pages across
+			/// \param ptr An address within the page
+			/// \return The node IDs, or an empty vector if the page is not interleaved or its
+			/// policy cannot be read
+			LIBRAPID_NODISCARD std::vector<int64_t> interleavedNodes(const void *ptr);
+		} // namespace detail
+	}	  // namespace numa
+
+	/// A standard-conforming allocator which places the pages of large allocations on the NUMA
+	/// nodes of the threads which will use them (see numa::Policy). Memory is aligned to a
+	/// 4 KiB page, which also satisfies LIBRAPID_MEM_ALIGN. Allocations too small to be
+	/// processed in parallel (see global::multithreadThreshold) are left to the operating
+	/// system's default placement.
+	/// \tparam T The type of the elements to allocate
+	/// \tparam policy How to place the pages of each allocation
+	template<typename T, numa::Policy policy = numa::Policy::FirstTouch>
+	class NumaAllocator {
+	public:
+		using value_type	  = T;
+		using pointer		  = T *;
+		using const_pointer	  = const T *;
+		using size_type		  = size_t;
+		using difference_type = ptrdiff_t;
+
+		/// The alignment of each allocation, in bytes
+		static constexpr size_t alignment = 4096 > LIBRAPID_MEM_ALIGN ? 4096 : LIBRAPID_MEM_ALIGN;
+
+		template<typename U>
+		struct rebind {
+			using other = NumaAllocator<U, policy>;
+		};
+
+		NumaAllocator() noexcept = default;
+
+		template<typename U>
+		NumaAllocator(const NumaAllocator<U, policy> &) noexcept {}
+
+		/// Allocate uninitialized memory for \p n elements, and place its pages
+		/// \param n The number of elements to allocate
+		/// \return A pointer to the allocated memory
+		LIBRAPID_NODISCARD T *allocate(size_t n) {
+			if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+				throw std::bad_array_new_length();
+			}
+
+			const size_t bytes = n * sizeof(T);
+			void *ptr		   = numa::detail::allocate(bytes, alignment);
+			if (static_cast<int64_t>(n) > global::multithreadThreshold) {
+				if (policy != numa::Policy::Interleave || !numa::detail::interleave(ptr, bytes)) {
+					numa::detail::firstTouch(ptr, bytes, sizeof(T));
+				}
+			}
+			return static_cast<T *>(ptr);
+		}
+
+		/// Free memory returned by allocate()
+		/// \param ptr The pointer to free
+		/// \param n The number of elements \p ptr was allocated with
+		void deallocate(T *ptr, size_t n) noexcept {
+			numa::detail::deallocate(ptr, n * sizeof(T), alignment);
+		}
+	};
+
+	template<typename T, typename U, numa::Policy policy>
+	constexpr bool operator==(const NumaAllocator<T, policy> &,
+							  const NumaAllocator<U, policy> &) noexcept {
+		return true;
+	}
+
+	template<typename T, typename U, numa::Policy policy>
+	constexpr bool operator!=(const NumaAllocator<T, policy> &,
+							  const NumaAllocator<U, policy> &) noexcept {
+		return false;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ALLOCATORS_NUMA_ALLOCATOR_HPP
@@ -3,17 +3,27 @@
 
 #include "sizetype.hpp"
 #include "strideTools.hpp"
+#include "allocators/allocators.hpp"
 #include "storage.hpp"
 #include "cudaStorage.hpp"
 #include "arrayTypeDef.hpp"
+#include "aliasing.hpp"
 #include "commaInitializer.hpp"
+#include "csv.hpp"
 #include "arrayContainer.hpp"
 #include "operations.hpp"
 #include "function.hpp"
 #include "assignOps.hpp"
+#include "reductions.hpp"
 #include "arrayView.hpp"
 #include "arrayViewString.hpp"
 #include "arrayFromData.hpp"
+#include "mappedArray.hpp"
+#include "arrayFile.hpp"
+#include "streaming.hpp"
 #include "transpose.hpp"
+#include "linalg/linalg.hpp"
+#include "combinedAssign.hpp"
+#include "sparse/sparse.hpp"
 
 #endif // LIBRAPID_ARRAY
\ No newline at end of file
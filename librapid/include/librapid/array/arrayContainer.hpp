@@ -52,6 +52,25 @@ namespace librapid {
 			/// array container \param value The value to initialize the memory with
 			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ShapeType &shape, const Scalar &value);
 
+			/// Create an array container with the given shape, without initializing its
+			/// elements (unless the scalar type must be constructed). Use this when every
+			/// element will be written before it is read, so the memory is first touched by the
+			/// code which fills it -- e.g. a multithreaded kernel -- rather than by a serial
+			/// initialization pass.
+			/// \param shape The shape of the array container
+			/// \return An array container with uninitialized elements
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static ArrayContainer
+			empty(const ShapeType &shape);
+
+			/// Load a two-dimensional array from a delimited text file, such as a CSV file, with
+			/// one row of the array on each line. The file is memory-mapped, and large files are
+			/// parsed by several threads at once, straight into the storage of the result.
+			/// \param path The path of the file
+			/// \param options The delimiter, comment character and number of lines to skip
+			/// \return The array, with shape (rows, columns)
+			LIBRAPID_NODISCARD static ArrayContainer fromCSV(const std::string &path,
+															 const CSVOptions &options = {});
+
 			/// Allows for a fixed-size array to be constructed with a fill value
 			/// \param value The value to fill the array with
 			LIBRAPID_ALWAYS_INLINE explicit ArrayContainer(const Scalar &value);
@@ -60,6 +79,13 @@ namespace librapid {
 			/// \param shape The shape of the array container
 			LIBRAPID_ALWAYS_INLINE explicit ArrayContainer(ShapeType &&shape);
 
+			/// Construct an array container which takes ownership of an existing storage object
+			/// (for example, one backed by a memory-mapped file). The storage must contain
+			/// exactly shape.size() elements.
+			/// \param shape The shape of the array container
+			/// \param storage The storage to use for the array's elements
+			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ShapeType &shape, StorageType &&storage);
+
 			/// Construct an array container from another array container.
 			/// \param other The array container to copy.
 			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ArrayContainer &other) = default;
@@ -101,6 +127,42 @@ namespace librapid {
 			LIBRAPID_ALWAYS_INLINE ArrayContainer &
 			operator=(const detail::Function<desc, Functor_, Args...> &function);
 
+			/// Add an array, function or scalar to this array container in place. The operand
+			/// must broadcast to the shape of this array, and the result is written back in a
+			/// single (vectorised) pass without resizing or allocating a temporary -- unless the
+			/// operand reads this array other than element for element (e.g. a += a[0]), in
+			/// which case the result is computed separately first. Results of a wider type
+			/// (such as int8_t + int8_t, which is an int) are converted back to the array's type.
+			/// \tparam T The type of the operand
+			/// \param other The value to add
+			/// \return A reference to this array container.
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator+=(const T &other);
+
+			/// Subtract an array, function or scalar from this array container in place.
+			/// \tparam T The type of the operand
+			/// \param other The value to subtract
+			/// \return A reference to this array container.
+			/// \see operator+=
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator-=(const T &other);
+
+			/// Multiply this array container by an array, function or scalar in place.
+			/// \tparam T The type of the operand
+			/// \param other The value to multiply by
+			/// \return A reference to this array container.
+			/// \see operator+=
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator*=(const T &other);
+
+			/// Divide this array container by an array, function or scalar in place.
+			/// \tparam T The type of the operand
+			/// \param other The value to divide by
+			/// \return A reference to this array container.
+			/// \see operator+=
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &operator/=(const T &other);
+
 			/// Allow ArrayContainer objects to be initialized with a comma separated list of
 			/// values. This makes use of the CommaInitializer class
 			/// \tparam T The type of the values
@@ -142,6 +204,18 @@ namespace librapid {
 			/// \return A Packet object from the array's storage at a specific index
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
 
+			/// Return a Packet object from the array's storage at a specific index, using an
+			/// aligned load. The address of the element at \p index must be aligned to the size of
+			/// a Packet (see packetIsAligned)
+			/// \param index The index to get the packet from
+			/// \return A Packet object from the array's storage at a specific index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetAligned(size_t index) const;
+
+			/// Return true if the element at \p index is aligned to the size of a Packet
+			/// \param index The index to check
+			/// \return True if packetAligned() can be used at \p index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool packetIsAligned(size_t index) const;
+
 			/// Return a Scalar from the array's storage at a specific index.
 			/// \param index The index to get the scalar from
 			/// \return A Scalar from the array's storage at a specific index
@@ -152,6 +226,13 @@ namespace librapid {
 			/// \param value The value to write to the array's storage
 			LIBRAPID_ALWAYS_INLINE void writePacket(size_t index, const Packet &value);
 
+			/// Write a Packet object to the array's storage at a specific index, using an aligned
+			/// store. The address of the element at \p index must be aligned to the size of a
+			/// Packet (see detail::alignedHead)
+			/// \param index The index to write the packet to
+			/// \param value The value to write to the array's storage
+			LIBRAPID_ALWAYS_INLINE void writePacketAligned(size_t index, const Packet &value);
+
 			/// Write a Scalar to the array's storage at a specific index
 			/// \param index The index to write the scalar to
 			/// \param value The value to write to the array's storage
@@ -163,6 +244,15 @@ namespace librapid {
 			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
 
 		private:
+			/// Implementation detail -- apply an element-wise binary operation to this array
+			/// container and \p other, writing the result back into this array container.
+			/// \tparam Functor The operation to apply
+			/// \tparam T The type of the operand
+			/// \param other The operand
+			/// \return A reference to this array container.
+			template<typename Functor, typename T>
+			LIBRAPID_ALWAYS_INLINE ArrayContainer &assignInPlace(const T &other);
+
 			ShapeType m_shape;	   // The shape type of the array
 			StorageType m_storage; // The storage container of the array
 		};
@@ -209,6 +299,51 @@ namespace librapid {
 						  "a FixedStorage object");
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		auto ArrayContainer<ShapeType_, StorageType_>::empty(const ShapeType &shape)
+		  -> ArrayContainer {
+			// Storage(size) allocates without initializing trivially constructible types
+			return ArrayContainer(shape);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		auto ArrayContainer<ShapeType_, StorageType_>::fromCSV(const std::string &path,
+															   const CSVOptions &options)
+		  -> ArrayContainer {
+			static_assert(typetraits::IsStorage<StorageType_>::value,
+						  "Only arrays with a Storage object can be loaded from text");
+
+			MmapAllocator<char> allocator(path, MmapMode::ReadOnly, MmapAdvice::Sequential);
+			const size_t bytes = allocator.fileElements();
+			MmapStorage<char> file(bytes, allocator);
+			const char *text = file.begin();
+
+			const int64_t threads =
+			  bytes >= detail::csvParallelBytes ? std::max<int64_t>(global::numThreads, 1) : 1;
+			const detail::CSVLayout layout = detail::scanCSV(text, bytes, options, threads);
+
+			auto result = empty(ShapeType({static_cast<size_t>(layout.rows),
+										   static_cast<size_t>(layout.cols)}));
+			Scalar *dst = result.storage().begin();
+
+			const auto numParts = static_cast<int64_t>(layout.parts.size());
+			std::vector<std::string> errors(layout.parts.size());
+
+#pragma omp parallel for shared(text, layout, options, dst, numParts, errors) default(none)        \
+  num_threads(numParts) if (numParts > 1)
+			for (int64_t i = 0; i < numParts; ++i) {
+				errors[i] = detail::parseCSVPart(text, layout.parts[i], layout.cols, options, dst);
+			}
+
+			for (const std::string &error : errors) {
+				if (!error.empty()) {
+					throw std::runtime_error(
+					  fmt::format("Failed to parse \"{}\": {}", path, error));
+				}
+			}
+			return result;
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(const Scalar &value) :
 				m_shape(detail::shapeFromFixedStorage(m_storage)), m_storage(value) {
@@ -218,6 +353,17 @@ namespace librapid {
 						  "a FixedStorage object");
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(const ShapeType &shape,
+																 StorageType &&storage) :
+				m_shape(shape),
+				m_storage(std::move(storage)) {
+			LIBRAPID_ASSERT(m_storage.size() == m_shape.size(),
+							"Storage with {} elements cannot hold an array of shape {}",
+							m_storage.size(),
+							m_shape.str());
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(ShapeType_ &&shape) :
 				m_shape(std::forward<ShapeType_>(shape)), m_storage(m_shape.size()) {}
@@ -241,7 +387,20 @@ namespace librapid {
 		auto ArrayContainer<ShapeType_, StorageType_>::operator=(
 		  const detail::Function<desc, Functor_, Args...> &function) -> ArrayContainer & {
 			using FunctionType = detail::Function<desc, Functor_, Args...>;
-			m_storage.resize(function.shape().size(), 0);
+
+			// Resizing frees the memory the function may still be reading from, and operations
+			// which are not element-wise (such as a = transpose(a)) may read elements which have
+			// already been overwritten, so evaluate these into a new array instead
+			constexpr bool elementWise = std::is_same_v<desc, detail::descriptor::Trivial>;
+			if ((!elementWise || function.shape().size() != m_storage.size()) &&
+				detail::mayAlias(function, detail::storageRange(m_storage))) {
+				*this = ArrayContainer(function);
+				return *this;
+			}
+
+			// The old values are overwritten, so they need not be kept or initialized
+			m_shape = function.shape();
+			m_storage.resize(m_shape.size(), 0);
 #if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
 			if (!std::is_same_v<typename FunctionType::Device, device::GPU> &&
 				m_storage.size() > global::multithreadThreshold && global::numThreads > 1)
@@ -260,6 +419,99 @@ namespace librapid {
 			return *this;
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator+=(const T &other)
+		  -> ArrayContainer & {
+			return assignInPlace<detail::Plus>(other);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator-=(const T &other)
+		  -> ArrayContainer & {
+			return assignInPlace<detail::Minus>(other);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator*=(const T &other)
+		  -> ArrayContainer & {
+			return assignInPlace<detail::Multiply>(other);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::operator/=(const T &other)
+		  -> ArrayContainer & {
+			return assignInPlace<detail::Divide>(other);
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		template<typename Functor, typename T>
+		auto ArrayContainer<ShapeType_, StorageType_>::assignInPlace(const T &other)
+		  -> ArrayContainer & {
+			// Each element of the result depends only on the corresponding element of this array
+			// (and of the broadcast operand), so the result can be written straight back into
+			// this array's storage as it is computed
+			auto function = [&]() {
+				if constexpr (typetraits::TypeInfo<T>::type == detail::LibRapidType::Scalar) {
+					return detail::makeFunction<detail::descriptor::Trivial, Functor>(
+					  *this, static_cast<Scalar>(other));
+				} else {
+					return detail::makeFunction<detail::descriptor::Trivial, Functor>(*this,
+																					  other);
+				}
+			}();
+
+			using FunctionType = decltype(function);
+			LIBRAPID_ASSERT(function.shape() == m_shape,
+							"Cannot broadcast an operand of shape {} into an array of shape {}",
+							function.shape().str(),
+							m_shape.str());
+
+			// An operand which reads this array other than element for element (such as a row
+			// of it, broadcast, or its transpose) may read elements which have already been
+			// overwritten, so the result is computed separately first
+			const bool inPlace =
+			  detail::readsInPlace(other, detail::storageRange(m_storage), m_shape);
+
+			if constexpr (std::is_same_v<typename FunctionType::Scalar, Scalar>) {
+				if (!inPlace) {
+					*this = ArrayContainer(function);
+					return *this;
+				}
+
+#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+				if (!std::is_same_v<typename FunctionType::Device, device::GPU> &&
+					m_storage.size() > global::multithreadThreshold && global::numThreads > 1)
+					detail::assignParallel(*this, function);
+				else
+#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+					detail::assign(*this, function);
+			} else {
+				static_assert(!std::is_same_v<typename FunctionType::Device, device::GPU>,
+							  "Compound assignment cannot change the scalar type of a GPU array");
+
+				// Integer promotion makes the result wider than the array (int8_t + int8_t is an
+				// int), so each element is converted back to the scalar type of the array
+				const int64_t size = m_storage.size();
+				const bool parallel =
+				  size > global::multithreadThreshold && global::numThreads > 1;
+				std::vector<Scalar> result(inPlace ? 0 : size);
+				Scalar *dst = inPlace ? m_storage.begin() : result.data();
+
+#pragma omp parallel for shared(dst, function, size) default(none)                                 \
+  num_threads(global::numThreads) if (parallel)
+				for (int64_t i = 0; i < size; ++i) {
+					dst[i] = static_cast<Scalar>(function.scalar(i));
+				}
+
+				if (!inPlace) std::copy(result.begin(), result.end(), m_storage.begin());
+			}
+			return *this;
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		template<typename T>
 		auto ArrayContainer<ShapeType_, StorageType_>::operator<<(const T &value)
@@ -365,6 +617,20 @@ namespace librapid {
 			return res;
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		auto ArrayContainer<ShapeType_, StorageType_>::packetAligned(size_t index) const -> Packet {
+			LIBRAPID_ASSERT(packetIsAligned(index),
+							"Aligned packet read from an unaligned address");
+			Packet res;
+			res.load(m_storage.begin() + index, Vc::Aligned);
+			return res;
+		}
+
+		template<typename ShapeType_, typename StorageType_>
+		bool ArrayContainer<ShapeType_, StorageType_>::packetIsAligned(size_t index) const {
+			return detail::isAligned(m_storage.begin() + index, sizeof(Packet));
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		auto ArrayContainer<ShapeType_, StorageType_>::scalar(size_t index) const -> Scalar {
 			return m_storage[index];
@@ -376,6 +642,15 @@ namespace librapid {
 			value.store(m_storage.begin() + index);
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		void ArrayContainer<ShapeType_, StorageType_>::writePacketAligned(size_t index,
+																		  const Packet &value) {
+			LIBRAPID_ASSERT(
+			  detail::isAligned(m_storage.begin() + index, sizeof(Packet)),
+			  "Aligned packet write to an unaligned address");
+			value.store(m_storage.begin() + index, Vc::Aligned);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		void ArrayContainer<ShapeType_, StorageType_>::write(size_t index, const Scalar &value) {
 			m_storage[index] = value;
@@ -0,0 +1,144 @@
+#ifndef LIBRAPID_ARRAY_ARRAY_FILE_HPP
+#define LIBRAPID_ARRAY_ARRAY_FILE_HPP
+
+/*
+ * Saving and loading arrays. Two formats are supported: the LibRapid format, which is a small
+ * binary header followed by the raw elements, and the NumPy .npy format. In both, the elements
+ * start at a multiple of 64 bytes into the file, so loaded arrays are memory-mapped directly
+ * from the file (see mapArray()) rather than being read into memory.
+ */
+
+namespace librapid {
+	/// The file formats supported by saveArray()
+	enum class ArrayFileFormat {
+		Auto,	// Npy if the path ends in ".npy", otherwise Native
+		Native, // A LibRapid header followed by the raw elements
+		Npy,	// The NumPy .npy format
+	};
+
+	namespace detail {
+		/// The information stored in the header of an array file
+		struct ArrayFileHeader {
+			std::string descr;		   // The NumPy type string of the elements, such as "<f8"
+			std::vector<size_t> shape; // The dimensions of the array
+			size_t payloadOffset = 0;  // The offset (in bytes) of the first element
+		};
+
+		/// Return the NumPy type string for elements of a given kind and size on this machine
+		/// \param kind 'b' (boolean), 'i' (signed integer), 'u' (unsigned integer) or 'f'
+		/// (floating point)
+		/// \param bytes The size of each element, in bytes
+		/// \return The type string
+		LIBRAPID_NODISCARD std::string npyDescr(char kind, size_t bytes);
+
+		/// Return the NumPy type string for \p Scalar
+		/// \tparam Scalar A boolean, integer or floating point type
+		/// \return The type string
+		template<typename Scalar>
+		LIBRAPID_NODISCARD std::string npyDescr() {
+			if constexpr (std::is_same_v<Scalar, bool>) {
+				return npyDescr('b', sizeof(Scalar));
+			} else if constexpr (std::is_integral_v<Scalar>) {
+				return npyDescr(std::is_signed_v<Scalar> ? 'i' : 'u', sizeof(Scalar));
+			} else {
+				static_assert(std::is_floating_point_v<Scalar>,
+							  "Only arrays of booleans, integers and floating point values can be "
+							  "saved and loaded");
+				return npyDescr('f', sizeof(Scalar));
+			}
+		}
+
+		/// Resolve ArrayFileFormat::Auto to the format implied by the extension of \p path
+		/// \param path The path of the file
+		/// \param format The requested format
+		/// \return The format to use
+		LIBRAPID_NODISCARD inline ArrayFileFormat resolveArrayFileFormat(const std::string &path,
+																		 ArrayFileFormat format) {
+			if (format != ArrayFileFormat::Auto) return format;
+			const bool npy = path.size() >= 4 && path.compare(path.size() - 4, 4, ".npy") == 0;
+			return npy ? ArrayFileFormat::Npy : ArrayFileFormat::Native;
+		}
+
+		/// Encode the header of an array file. The header is padded so that the elements
+		/// which follow it are aligned to 64 bytes.
+		/// \param descr The NumPy type string of the elements
+		/// \param shape The dimensions of the array
+		/// \param format The format of the file (Auto is not allowed)
+		/// \return The encoded header
+		LIBRAPID_NODISCARD std::string encodeArrayFileHeader(const std::string &descr,
+															 const std::vector<size_t> &shape,
+															 ArrayFileFormat format);
+
+		/// Read and validate the header of an array file. The format is detected from the
+		/// contents of the file.
+		/// \param path The path of the file
+		/// \return The decoded header
+		LIBRAPID_NODISCARD ArrayFileHeader readArrayFileHeader(const std::string &path);
+
+		/// Replace the file at \p path with \p header followed by \p bytes bytes of \p data.
+		/// Large payloads are written in parallel.
+		/// \param path The path of the file
+		/// \param header The encoded header
+		/// \param data The elements to write
+		/// \param bytes The number of bytes to write from \p data
+		void writeArrayFile(const std::string &path, const std::string &header, const void *data,
+							size_t bytes);
+	} // namespace detail
+
+	/// Save an array to a file, which can be loaded with loadArray() or, in the Npy format, with
+	/// `numpy.load`
+	/// \tparam ShapeType The shape type of the array
+	/// \tparam StorageType The storage type of the array
+	/// \param path The path of the file, which is replaced if it exists
+	/// \param array The array to save
+	/// \param format The format of the file
+	template<typename ShapeType, typename StorageType>
+	void saveArray(const std::string &path,
+				   const array::ArrayContainer<ShapeType, StorageType> &array,
+				   ArrayFileFormat format = ArrayFileFormat::Auto) {
+		static_assert(typetraits::IsStorage<StorageType>::value ||
+						typetraits::IsFixedStorage<StorageType>::value,
+					  "Only arrays stored in main memory can be saved");
+		using Scalar = typename StorageType::Scalar;
+
+		const auto &shape = array.shape();
+		std::vector<size_t> dims(shape.ndim());
+		for (size_t i = 0; i < dims.size(); ++i) dims[i] = shape[i];
+
+		const std::string header =
+		  detail::encodeArrayFileHeader(detail::npyDescr<Scalar>(),
+										dims,
+										detail::resolveArrayFileFormat(path, format));
+		const size_t bytes = static_cast<size_t>(shape.size()) * sizeof(Scalar);
+		detail::writeArrayFile(path, header, array.storage().begin(), bytes);
+	}
+
+	/// Load an array saved by saveArray() or `numpy.save`. The file is memory-mapped, so no
+	/// data is read until it is used. Copying the result produces an ordinary in-memory array.
+	/// \tparam Scalar The type of the elements, which must match the type stored in the file
+	/// \param path The path of the file
+	/// \param mode How the file is mapped. With MmapMode::CopyOnWrite (the default), the array
+	/// can be modified without changing the file
+	/// \param advice The access pattern hint for the mapping
+	/// \return The file-backed array
+	template<typename Scalar>
+	LIBRAPID_NODISCARD Array<Scalar, MmapStorage<Scalar>>
+	loadArray(const std::string &path, MmapMode mode = MmapMode::CopyOnWrite,
+			  MmapAdvice advice = MmapAdvice::Normal) {
+		using ShapeType = typename Array<Scalar, MmapStorage<Scalar>>::ShapeType;
+
+		const detail::ArrayFileHeader header = detail::readArrayFileHeader(path);
+		const std::string expected			 = detail::npyDescr<Scalar>();
+		if (header.descr != expected) {
+			throw std::runtime_error(
+			  fmt::format("\"{}\" contains elements of type '{}', which cannot be loaded as '{}'",
+						  path,
+						  header.descr,
+						  expected));
+		}
+
+		return mapArray<Scalar>(path, ShapeType(header.shape), mode, advice, header.payloadOffset);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_ARRAY_FILE_HPP
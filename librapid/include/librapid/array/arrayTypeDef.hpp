@@ -53,6 +53,21 @@ namespace librapid {
 	template<typename... Inputs>
 	using FunctionRef = detail::Function<Inputs...>;
 
+	namespace detail {
+		/// The type of the arrays LibRapid evaluates expressions into internally, and frees
+		/// before returning (such as an operand of a matrix multiplication which is not stored
+		/// contiguously). On the CPU, these take their memory from the caching pool (see
+		/// CachingAllocator), so repeating an operation reuses the same blocks rather than
+		/// allocating and page-faulting in fresh memory each time.
+		/// \tparam Scalar The scalar type of the array
+		/// \tparam Device The device the array is stored on
+		template<typename Scalar, typename Device>
+		using TemporaryArray =
+		  std::conditional_t<std::is_same_v<Device, device::CPU>,
+							 Array<Scalar, Storage<Scalar, CachingAllocator<Scalar>>>,
+							 Array<Scalar, Device>>;
+	} // namespace detail
+
 	namespace array {
 		/// An intermediate type to represent a slice or view of an array.
 		/// \tparam T The type of the array.
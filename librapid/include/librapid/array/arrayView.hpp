@@ -8,7 +8,8 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::ArrayView;
 			using Scalar							   = typename TypeInfo<std::decay_t<T>>::Scalar;
 			using Device							   = typename TypeInfo<std::decay_t<T>>::Device;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation =
+			  TypeInfo<std::decay_t<T>>::allowVectorisation;
 		};
 	} // namespace typetraits
 
@@ -24,6 +25,8 @@ namespace librapid {
 			using StrideType	 = typename BaseType::StrideType;
 			using ShapeType		 = typename BaseType::ShapeType;
 			using Device		 = typename typetraits::TypeInfo<BaseType>::Device;
+			using Packet		 = typename typetraits::TypeInfo<Scalar>::Packet;
+			static constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
 
 			/// Default constructor should never be used
 			ArrayView() = delete;
@@ -89,6 +92,10 @@ namespace librapid {
 			/// \return Offset
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t offset() const;
 
+			/// Access the array referenced by this ArrayView
+			/// \return The referenced array
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const BaseType &ref() const;
+
 			/// Set the Shape of this ArrayView to something else. Intended for internal use only.
 			/// \param shape The new shape of this ArrayView
 			void setShape(const ShapeType &shape);
@@ -111,6 +118,14 @@ namespace librapid {
 			/// \return Scalar at the given index
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto scalar(int64_t index) const;
 
+			/// Return a Packet of the elements starting at a given (row-major) index in this
+			/// ArrayView. The coordinate of the first element is computed once, and the remaining
+			/// elements are found by stepping along the innermost dimension. If the innermost
+			/// stride is one, this is a contiguous load -- otherwise the elements are gathered.
+			/// \param index The index of the first element of the Packet
+			/// \return Packet starting at the given index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(int64_t index) const;
+
 			/// Evaluate the contents of this ArrayView object and return an Array instance from
 			/// it. Depending on your use case, this may result in more performant code, but the new
 			/// Array will not reference the original data in the ArrayView.
@@ -124,6 +139,19 @@ namespace librapid {
 			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
 
 		private:
+			/// Map a row-major index into this ArrayView to an index into the referenced array
+			/// \param index The index into this ArrayView
+			/// \return The corresponding index into the referenced array
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t refIndex(int64_t index) const;
+
+			/// Load a Packet of elements from the referenced array, starting at \p index and
+			/// separated by \p stride elements
+			/// \param index The index of the first element in the referenced array
+			/// \param stride The distance between consecutive elements
+			/// \return The loaded Packet
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet refPacket(int64_t index,
+																	   int64_t stride) const;
+
 			ArrayType &m_ref;
 			ShapeType m_shape;
 			StrideType m_stride;
@@ -149,13 +177,12 @@ namespace librapid {
 			  index,
 			  m_shape[0]);
 			ArrayView<ArrayType> view(m_ref);
-			const auto stride = Stride(m_shape);
 			view.setShape(m_shape.subshape(1, ndim()));
 			if (ndim() == 1)
 				view.setStride(Stride({1}));
 			else
-				view.setStride(stride.subshape(1, ndim()));
-			view.setOffset(m_offset + index * stride[0]);
+				view.setStride(m_stride.subshape(1, ndim()));
+			view.setOffset(m_offset + index * static_cast<int64_t>(m_stride[0]));
 			return view;
 		}
 
@@ -203,48 +230,114 @@ namespace librapid {
 			m_offset = offset;
 		}
 
+		template<typename T>
+		auto ArrayView<T>::ref() const -> const BaseType & {
+			return m_ref;
+		}
+
 		template<typename T>
 		auto ArrayView<T>::ndim() const -> int64_t {
 			return m_shape.ndim();
 		}
 
+		template<typename T>
+		auto ArrayView<T>::refIndex(int64_t index) const -> int64_t {
+			int64_t offset = m_offset;
+			for (int64_t i = ndim() - 1; i >= 0; --i) {
+				const auto dim = static_cast<int64_t>(m_shape[i]);
+				offset += (index % dim) * static_cast<int64_t>(m_stride[i]);
+				index /= dim;
+			}
+			return offset;
+		}
+
+		template<typename T>
+		auto ArrayView<T>::refPacket(int64_t index, int64_t stride) const -> Packet {
+			if (stride == 1) return m_ref.packet(index);
+
+			Packet res;
+			if constexpr (typetraits::typetraits::IsArrayContainer<BaseType>::value) {
+				typename Packet::IndexType indices;
+				for (int64_t i = 0; i < packetWidth; ++i) {
+					indices[i] = static_cast<int>(i * stride);
+				}
+				res.gather(m_ref.storage().begin() + index, indices);
+			} else {
+				for (int64_t i = 0; i < packetWidth; ++i) {
+					res[i] = m_ref.scalar(index + i * stride);
+				}
+			}
+			return res;
+		}
+
 		template<typename T>
 		auto ArrayView<T>::scalar(int64_t index) const -> auto {
-			if (ndim() == 0) return m_ref.scalar(m_offset);
+			return m_ref.scalar(refIndex(index));
+		}
 
-			ShapeType tmp	= ShapeType::zeros(ndim());
-			tmp[ndim() - 1] = index % m_shape[ndim() - 1];
-			for (int64_t i = ndim() - 2; i >= 0; --i) {
-				index /= m_shape[i + 1];
-				tmp[i] = index % m_shape[i];
+		template<typename T>
+		auto ArrayView<T>::packet(int64_t index) const -> Packet {
+			const auto inner	   = static_cast<int64_t>(m_shape[ndim() - 1]);
+			const auto innerStride = static_cast<int64_t>(m_stride[ndim() - 1]);
+			int64_t col			   = index % inner;
+			int64_t p			   = refIndex(index);
+
+			// The packet lies within a single row
+			if (col + packetWidth <= inner) return refPacket(p, innerStride);
+
+			// The packet straddles multiple rows, so only recompute the coordinate when a row ends
+			Packet res;
+			for (int64_t i = 0; i < packetWidth; ++i) {
+				res[i] = m_ref.scalar(p);
+				if (++col == inner && i + 1 < packetWidth) {
+					col = 0;
+					p	= refIndex(index + i + 1);
+				} else {
+					p += innerStride;
+				}
 			}
-			int64_t offset = 0;
-			for (int64_t i = 0; i < ndim(); ++i) { offset += tmp[i] * m_stride[i]; }
-			return m_ref.scalar(m_offset + offset);
+			return res;
 		}
 
 		template<typename T>
 		auto ArrayView<T>::eval() const -> ArrayType {
 			ArrayType res(m_shape);
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
 			const int64_t ndim = m_shape.ndim();
+			if (ndim == 0) {
+				res.storage()[0] = m_ref.scalar(m_offset);
+				return res;
+			}
 
-			do {
-				res.storage()[d++] = m_ref.scalar(p + m_offset);
+			// Walk the view one row (of the innermost dimension) at a time, stepping the outer
+			// coordinates incrementally, so no division is needed per element
+			const auto inner	   = static_cast<int64_t>(m_shape[ndim - 1]);
+			const auto innerStride = static_cast<int64_t>(m_stride[ndim - 1]);
+			const auto rows		   = static_cast<int64_t>(m_shape.size()) / inner;
+			ShapeType coord		   = ShapeType::zeros(ndim);
+			int64_t p			   = m_offset;
+
+			for (int64_t row = 0, d = 0; row < rows; ++row, d += inner) {
+				int64_t col = 0;
+				if constexpr (typetraits::TypeInfo<ArrayView>::allowVectorisation) {
+					for (; col + packetWidth <= inner; col += packetWidth) {
+						res.writePacket(d + col, refPacket(p + col * innerStride, innerStride));
+					}
+				}
+				for (; col < inner; ++col) {
+					res.storage()[d + col] = m_ref.scalar(p + col * innerStride);
+				}
 
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
+				for (int64_t adim = ndim - 2; adim >= 0; --adim) {
 					if (++coord[adim] == m_shape[adim]) {
 						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
+						p -= (static_cast<int64_t>(m_shape[adim]) - 1) *
+							 static_cast<int64_t>(m_stride[adim]);
 					} else {
-						p = p + m_stride[adim];
+						p += static_cast<int64_t>(m_stride[adim]);
 						break;
 					}
 				}
-			} while (idim < ndim);
+			}
 
 			return res;
 		}
@@ -1,104 +1,134 @@
 #ifndef LIBRAPID_ARRAY_ARRAY_VIEW_STRING_HPP
 #define LIBRAPID_ARRAY_ARRAY_VIEW_STRING_HPP
 
+/*
+ * Converting arrays to strings. Each element which is printed is evaluated and formatted exactly
+ * once, into a single buffer, and the widths of the columns are measured from that buffer. The
+ * result is then written out with the elements aligned down the columns. Arrays with more than
+ * global::printThreshold elements are summarised, like NumPy, by printing only the first and
+ * last global::printEdgeItems indices along each dimension, so only those elements are ever
+ * evaluated -- even for lazy expressions.
+ */
+
 namespace librapid {
 	namespace detail {
-		/// Count the width of a value for use in a String representation of an Array. The returned
-		/// tuple contains the length of the value before and after the central point. For floating
-		/// point values, the central point is the decimal point. For integer values, the central
-		/// point is the end of the value
-		/// \tparam T The type of the value to count the width of
-		/// \param val The value to count the width of
-		/// \param format The format string to use when converting the value to a String
+		/// The formatted elements of an array, and the layout to print them in
+		struct FormattedArray {
+			std::vector<std::vector<int64_t>> indices; // The printed indices along each dimension
+			fmt::memory_buffer cells;				   // The formatted elements, back to back
+			std::vector<size_t> cellEnds;			   // The end of each element in cells
+			std::vector<std::pair<int64_t, int64_t>> widths; // The width of each printed column
+			bool alignPoint = false; // If true, columns are aligned on the decimal point
+		};
+
+		/// Count the width of a formatted value for use in a String representation of an Array.
+		/// The returned pair contains the length of the value before and after the central
+		/// point. If \p alignPoint is true, the central point is the decimal point (or the end of
+		/// the value if there is none), otherwise it is always the end of the value.
+		/// \param first The first character of the value
+		/// \param last One past the last character of the value
+		/// \param alignPoint True if the value should be aligned on its decimal point
 		/// \return The relevant widths of the value
-		template<typename T, typename std::enable_if_t<std::is_fundamental_v<T>, int> = 0>
-		LIBRAPID_INLINE std::pair<int64_t, int64_t> countWidth(const T &val,
-															   const std::string &format) {
-			std::string str = fmt::format(format, val);
-			auto point		= str.find('.');
-			if (point == std::string::npos) { return {str.size(), 0}; }
-			return {point, str.size() - point};
+		LIBRAPID_INLINE std::pair<int64_t, int64_t> countWidth(const char *first, const char *last,
+															   bool alignPoint) {
+			const int64_t size = last - first;
+			if (!alignPoint) return {size, 0};
+			const char *point = std::find(first, last, '.');
+			return {point - first, last - point};
 		}
 
-		template<typename T, typename std::enable_if_t<!std::is_fundamental_v<T>, int> = 0>
-		LIBRAPID_INLINE std::pair<int64_t, int64_t> countWidth(const T &val,
-															   const std::string &format) {
-			std::string str = fmt::format(format, val);
-			return {str.size(), 0};
-		}
+		/// Return the indices along one dimension of an array which are printed. When the array
+		/// is summarised, only the first and last global::printEdgeItems indices are printed, and
+		/// the ones in between are replaced by a single -1.
+		/// \param size The length of the dimension
+		/// \param summarise True if the array is being summarised
+		/// \return The printed indices
+		LIBRAPID_NODISCARD std::vector<int64_t> printedIndices(int64_t size, bool summarise);
 
+		/// Write a formatted array to a buffer, with the elements aligned down the columns
+		/// \param out The buffer to write to
+		/// \param array The formatted elements and their layout
+		void writeFormattedArray(fmt::memory_buffer &out, const FormattedArray &array);
+
+		/// Write a string representation of an ArrayView to a buffer, summarising it if it has
+		/// more than global::printThreshold elements. Only the printed elements are evaluated.
+		/// \tparam T The type of the array referenced by the ArrayView
+		/// \param out The buffer to write to
+		/// \param view The ArrayView to format
+		/// \param format The format string used for each element
 		template<typename T>
-		std::vector<std::pair<int64_t, int64_t>> countColumnWidths(const array::ArrayView<T> &view,
-																   const std::string &format) {
-			if (view.ndim() == 0) {
-				// Scalar
-				return {countWidth(view.scalar(0), format)};
-			} else if (view.ndim() == 1) {
-				// Vector
-				std::vector<std::pair<int64_t, int64_t>> widths(view.shape()[0]);
-				for (int64_t i = 0; i < static_cast<int64_t>(view.shape()[0]); ++i) {
-					widths[i] = countWidth(view.scalar(i), format);
-				}
-				return widths;
-			} else {
-				// General
-				std::vector<std::pair<int64_t, int64_t>> widths =
-				  countColumnWidths(view[0], format);
-				for (int64_t i = 1; i < static_cast<int64_t>(view.shape()[0]); ++i) {
-					auto subWidths = countColumnWidths(view[i], format);
-					for (int64_t j = 0; j < static_cast<int64_t>(widths.size()); ++j) {
-						widths[j].first	 = ::librapid::max(widths[j].first, subWidths[j].first);
-						widths[j].second = ::librapid::max(widths[j].second, subWidths[j].second);
-					}
-				}
-				return widths;
+		void formatArrayView(fmt::memory_buffer &out, const array::ArrayView<T> &view,
+							 const std::string &format) {
+			using Scalar = typename array::ArrayView<T>::Scalar;
+
+			const int64_t ndim = view.ndim();
+			if (ndim == 0) {
+				fmt::format_to(std::back_inserter(out), format, view.scalar(0));
+				return;
 			}
-		}
 
-		template<typename T>
-		std::string arrayViewToString(const array::ArrayView<T> &view, const std::string &format,
-									  const std::vector<std::pair<int64_t, int64_t>> &widths,
-									  int64_t indent) {
-			if (view.ndim() == 0) { return fmt::format(format, view.scalar(0)); }
-
-			if (view.ndim() == 1) {
-				std::string str = "[";
-				for (int64_t i = 0; i < static_cast<int64_t>(view.shape()[0]); i++) {
-					std::pair<int64_t, int64_t> width = detail::countWidth(view.scalar(i), format);
-					str += fmt::format("{:>{}}{}{:>{}}",
-									   "",
-									   widths[i].first - width.first,
-									   fmt::format(format, view.scalar(i)),
-									   "",
-									   widths[i].second - width.second);
-					if (i != view.shape()[0] - 1) { str += " "; }
+			const auto shape = view.shape();
+			const auto size	 = static_cast<int64_t>(shape.size());
+
+			FormattedArray array;
+			array.alignPoint = std::is_fundamental_v<Scalar>;
+			array.indices.resize(ndim);
+			for (int64_t d = 0; d < ndim; ++d) {
+				array.indices[d] =
+				  printedIndices(static_cast<int64_t>(shape[d]), size > global::printThreshold);
+			}
+			array.widths.resize(array.indices[ndim - 1].size(), {0, 0});
+
+			// The positions of the printed elements (not the gaps) along each dimension
+			std::vector<std::vector<size_t>> positions(ndim);
+			bool anyPrinted = size > 0;
+			for (int64_t d = 0; d < ndim; ++d) {
+				for (size_t k = 0; k < array.indices[d].size(); ++k) {
+					if (array.indices[d][k] >= 0) positions[d].push_back(k);
 				}
-				str += "]";
-				return str;
+				anyPrinted = anyPrinted && !positions[d].empty();
 			}
 
-			std::string str = "[";
-			for (int64_t i = 0; i < static_cast<int64_t>(view.shape()[0]); i++) {
-				if (i > 0) str += std::string(indent + 1, ' ');
-				str += arrayViewToString(view[i], format, widths, indent + 1);
-				if (i != view.shape()[0] - 1) {
-					str += "\n";
-					if (view.ndim() > 2) { str += "\n"; }
+			// Format each printed element once, in the order they are written out
+			std::vector<size_t> counter(ndim, 0);
+			while (anyPrinted) {
+				int64_t index = 0;
+				for (int64_t d = 0; d < ndim; ++d) {
+					index = index * static_cast<int64_t>(shape[d]) +
+							array.indices[d][positions[d][counter[d]]];
+				}
+
+				const size_t begin = array.cells.size();
+				fmt::format_to(std::back_inserter(array.cells), format, view.scalar(index));
+				array.cellEnds.push_back(array.cells.size());
+
+				const char *cells = array.cells.data();
+				const auto width =
+				  countWidth(cells + begin, cells + array.cells.size(), array.alignPoint);
+				auto &column  = array.widths[positions[ndim - 1][counter[ndim - 1]]];
+				column.first  = ::librapid::max(column.first, width.first);
+				column.second = ::librapid::max(column.second, width.second);
+
+				int64_t d = ndim - 1;
+				for (; d >= 0; --d) {
+					if (++counter[d] < positions[d].size()) break;
+					counter[d] = 0;
 				}
+				if (d < 0) break;
 			}
-			str += "]";
-			return str;
+
+			writeFormattedArray(out, array);
 		}
 	} // namespace detail
 
 	namespace array {
 		template<typename T>
 		auto ArrayView<T>::str(const std::string &format) const -> std::string {
-			std::vector<std::pair<int64_t, int64_t>> widths =
-			  detail::countColumnWidths(*this, format);
-			return detail::arrayViewToString(*this, format, widths, 0);
+			fmt::memory_buffer buffer;
+			detail::formatArrayView(buffer, *this, format);
+			return fmt::to_string(buffer);
 		}
 	} // namespace array
 } // namespace librapid
 
-#endif // LIBRAPID_ARRAY_ARRAY_VIEW_STRING_HPP
\ No newline at end of file
+#endif // LIBRAPID_ARRAY_ARRAY_VIEW_STRING_HPP
@@ -5,6 +5,58 @@ namespace librapid::detail {
 	// All assignment operators are forward declared in "forward.hpp" so they can be used
 	// elsewhere. They are defined here.
 
+	/// Return the number of elements in each tile for tiled evaluation. A single pass over a
+	/// tile touches the arguments and result of one operation, so each tile is sized to a
+	/// quarter of the L1 cache.
+	/// \tparam Scalar The scalar type of the result
+	/// \return The number of elements in each tile
+	template<typename Scalar>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t tileSize() {
+		constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+		constexpr int64_t scalarBytes = sizeof(Scalar);
+		const int64_t lineElements	  = global::cacheLineSize / scalarBytes;
+		const int64_t alignment		  = std::max(packetWidth, std::max(lineElements, int64_t(1)));
+
+		int64_t elements = global::l1CacheSize / (4 * scalarBytes);
+		elements		 = std::min(elements, maxTileElements);
+		return std::max(elements - (elements % alignment), alignment);
+	}
+
+	/// Tiled array assignment -- the index space is split into cache-sized tiles, and the whole
+	/// expression is evaluated one tile at a time (see Function::evaluateTile). This is used
+	/// for expressions which read from at least global::tiledEvaluationThreshold arrays, which
+	/// would otherwise stream too many arrays at once for the cache and prefetchers to keep up.
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam StorageAllocator The Allocator of the Storage object
+	/// \tparam Functor_ The function type
+	/// \tparam Args The argument types of the function
+	/// \param lhs The array container to assign to
+	/// \param function The function to assign
+	/// \param parallel If true, tiles are evaluated in parallel
+	template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+			 typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assignTiled(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+				const detail::Function<descriptor::Trivial, Functor_, Args...> &function,
+				bool parallel) {
+		using Scalar =
+		  typename array::ArrayContainer<ShapeType_,
+										 Storage<StorageScalar, StorageAllocator>>::Scalar;
+
+		const int64_t size	   = function.shape().size();
+		const int64_t tile	   = tileSize<Scalar>();
+		const int64_t numTiles = (size + tile - 1) / tile;
+		Scalar *dst			   = lhs.storage().begin();
+
+#pragma omp parallel for shared(function, size, tile, numTiles, dst) default(none)                 \
+  num_threads(global::numThreads) if (parallel)
+		for (int64_t i = 0; i < numTiles; ++i) {
+			const int64_t begin = i * tile;
+			function.evaluateTile(begin, std::min(tile, size - begin), dst + begin);
+		}
+	}
+
 	/// Trivial array assignment operator -- assignment can be done with a single vectorised
 	/// loop over contiguous data.
 	/// \tparam ShapeType_ The shape type of the array container
@@ -19,18 +71,17 @@ namespace librapid::detail {
 	LIBRAPID_ALWAYS_INLINE void
 	assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
 		   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
-		using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
 		using Scalar =
 		  typename array::ArrayContainer<ShapeType_,
 										 Storage<StorageScalar, StorageAllocator>>::Scalar;
 		constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
-		constexpr bool allowVectorisation =
-		  typetraits::TypeInfo<
-			detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation &&
-		  Function::argsAreSameType;
 
-		const int64_t size		 = function.shape().size();
-		const int64_t vectorSize = size - (size % packetWidth);
+		constexpr bool allowVectorisation = typetraits::TypeInfo<
+		  detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation;
+		constexpr int64_t numSources = typetraits::NumArraySources<
+		  detail::Function<descriptor::Trivial, Functor_, Args...>>::value;
+
+		const int64_t size = function.shape().size();
 
 		// Ensure the function can actually be assigned to the array container
 		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
@@ -38,12 +89,33 @@ namespace librapid::detail {
 		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
 
 		if constexpr (allowVectorisation) {
-			for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-				lhs.writePacket(index, function.packet(index));
+			if (numSources >= global::tiledEvaluationThreshold) {
+				assignTiled(lhs, function, false);
+				return;
+			}
+
+			// Assign elements individually until the destination is aligned, so every packet
+			// can be written with an aligned store
+			const int64_t head		= alignedHead(lhs.storage().begin(), size);
+			const int64_t vectorEnd = size - ((size - head) % packetWidth);
+			for (int64_t index = 0; index < head; ++index) {
+				lhs.write(index, function.scalar(index));
+			}
+
+			// Arrays allocated by LibRapid share the destination's alignment, so their packets
+			// can usually be read with aligned loads as well
+			if (function.packetIsAligned(head)) {
+				for (int64_t index = head; index < vectorEnd; index += packetWidth) {
+					lhs.writePacketAligned(index, function.packetAligned(index));
+				}
+			} else {
+				for (int64_t index = head; index < vectorEnd; index += packetWidth) {
+					lhs.writePacketAligned(index, function.packet(index));
+				}
 			}
 
 			// Assign the remaining elements
-			for (int64_t index = vectorSize; index < size; ++index) {
+			for (int64_t index = vectorEnd; index < size; ++index) {
 				lhs.write(index, function.scalar(index));
 			}
 		} else {
@@ -74,6 +146,10 @@ namespace librapid::detail {
 		constexpr bool allowVectorisation = typetraits::TypeInfo<
 		  detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation;
 
+		// FixedStorage is aligned to LIBRAPID_MEM_ALIGN bytes, so every packet is aligned if
+		// that is a multiple of the packet size
+		constexpr bool alignedStores = LIBRAPID_MEM_ALIGN % (packetWidth * sizeof(Scalar)) == 0;
+
 		// Ensure the function can actually be assigned to the array container
 		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
 					  "Function return type must be the same as the array container's scalar type");
@@ -81,7 +157,11 @@ namespace librapid::detail {
 
 		if constexpr (allowVectorisation) {
 			for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-				lhs.writePacket(index, function.packet(index));
+				if constexpr (alignedStores) {
+					lhs.writePacketAligned(index, function.packet(index));
+				} else {
+					lhs.writePacket(index, function.packet(index));
+				}
 			}
 
 			// Assign the remaining elements
@@ -118,9 +198,10 @@ namespace librapid::detail {
 
 		constexpr bool allowVectorisation = typetraits::TypeInfo<
 		  detail::Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation;
+		constexpr int64_t numSources = typetraits::NumArraySources<
+		  detail::Function<descriptor::Trivial, Functor_, Args...>>::value;
 
-		const int64_t size		 = function.shape().size();
-		const int64_t vectorSize = size - (size % packetWidth);
+		const int64_t size = function.shape().size();
 
 		// Ensure the function can actually be assigned to the array container
 		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
@@ -128,20 +209,41 @@ namespace librapid::detail {
 		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
 
 		if constexpr (allowVectorisation) {
-#pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
+			if (numSources >= global::tiledEvaluationThreshold) {
+				assignTiled(lhs, function, true);
+				return;
+			}
+
+			// Assign elements individually until the destination is aligned, so every packet
+			// can be written with an aligned store
+			const int64_t head		= alignedHead(lhs.storage().begin(), size);
+			const int64_t vectorEnd = size - ((size - head) % packetWidth);
+			for (int64_t index = 0; index < head; ++index) {
+				lhs.write(index, function.scalar(index));
+			}
+
+			// See assign(ArrayContainer<ShapeType_, Storage<...>> &, const Function &)
+			if (function.packetIsAligned(head)) {
+#pragma omp parallel for shared(head, vectorEnd, lhs, function) default(none)                      \
   num_threads(global::numThreads)
-			for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-				lhs.writePacket(index, function.packet(index));
+				for (int64_t index = head; index < vectorEnd; index += packetWidth) {
+					lhs.writePacketAligned(index, function.packetAligned(index));
+				}
+			} else {
+#pragma omp parallel for shared(head, vectorEnd, lhs, function) default(none)                      \
+  num_threads(global::numThreads)
+				for (int64_t index = head; index < vectorEnd; index += packetWidth) {
+					lhs.writePacketAligned(index, function.packet(index));
+				}
 			}
 
 			// Assign the remaining elements
-			for (int64_t index = vectorSize; index < size; ++index) {
+			for (int64_t index = vectorEnd; index < size; ++index) {
 				lhs.write(index, function.scalar(index));
 			}
 		} else {
-#pragma omp parallel for shared(vectorSize, lhs, function, size) default(none)                     \
-  num_threads(global::numThreads)
-			for (int64_t index = vectorSize; index < size; ++index) {
+#pragma omp parallel for shared(lhs, function, size) default(none) num_threads(global::numThreads)
+			for (int64_t index = 0; index < size; ++index) {
 				lhs.write(index, function.scalar(index));
 			}
 		}
@@ -166,6 +268,9 @@ namespace librapid::detail {
 		constexpr int64_t elements	 = ::librapid::product<StorageSize...>();
 		constexpr int64_t vectorSize = elements - (elements % packetWidth);
 
+		// See assign(ArrayContainer<ShapeType_, FixedStorage<...>> &, const Function &)
+		constexpr bool alignedStores = LIBRAPID_MEM_ALIGN % (packetWidth * sizeof(Scalar)) == 0;
+
 		// Ensure the function can actually be assigned to the array container
 		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
 					  "Function return type must be the same as the array container's scalar type");
@@ -174,7 +279,11 @@ namespace librapid::detail {
 #pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
   num_threads(global::numThreads)
 		for (int64_t index = 0; index < vectorSize; index += packetWidth) {
-			lhs.writePacket(index, function.packet(index));
+			if constexpr (alignedStores) {
+				lhs.writePacketAligned(index, function.packet(index));
+			} else {
+				lhs.writePacket(index, function.packet(index));
+			}
 		}
 
 		// Assign the remaining elements
@@ -219,6 +328,23 @@ namespace librapid::detail {
 			return obj;
 		}
 
+		/// Returns true if a Function argument can be passed directly to a CUDA kernel -- that
+		/// is, it is a scalar or it does not need to be broadcast.
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param shape The shape of the Function's result
+		/// \return True if no broadcasting is required
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+		cudaArgumentIsFlat(const T &obj, const Shape<size_t, 32> &shape) {
+			if constexpr (typetraits::TypeInfo<T>::type ==
+						  ::librapid::detail::LibRapidType::Scalar) {
+				return true;
+			} else {
+				return obj.shape() == shape;
+			}
+		}
+
 		template<typename T>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const auto &
 		cudaTupleEvaluatorImpl(const T &scalar) {
@@ -271,6 +397,10 @@ namespace librapid::detail {
 		cudaTupleEvaluator(std::index_sequence<I...>, const std::string &filename,
 						   const std::string &kernelName, Pointer *dst,
 						   const detail::Function<descriptor, Functor, Args...> &function) {
+			LIBRAPID_ASSERT(
+			  (cudaArgumentIsFlat(std::get<I>(function.args()), function.shape()) && ...),
+			  "Broadcasting is not yet supported for CUDA arrays");
+
 			runKernel<Pointer, typename typetraits::TypeInfo<std::decay_t<Args>>::Scalar...>(
 			  filename,
 			  kernelName,
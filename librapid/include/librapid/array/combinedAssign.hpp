@@ -0,0 +1,273 @@
+#ifndef LIBRAPID_ARRAY_COMBINED_ASSIGN_HPP
+#define LIBRAPID_ARRAY_COMBINED_ASSIGN_HPP
+
+namespace librapid::detail {
+	/// Evaluates as true if T is an element-wise Function which contains a non-trivial
+	/// operation (such as a matrix multiplication) somewhere in its arguments
+	/// \tparam T The type to check
+	template<typename T>
+	struct IsCombinedFunction : std::false_type {};
+
+	template<typename Functor_, typename... Args>
+	struct IsCombinedFunction<Function<descriptor::Combined, Functor_, Args...>>
+			: std::true_type {};
+
+	/// Evaluates as true if T is a lazily-evaluated matrix multiplication
+	/// \tparam T The type to check
+	template<typename T>
+	struct IsMatmulFunction : std::false_type {};
+
+	template<typename Functor_, typename LHS, typename RHS>
+	struct IsMatmulFunction<Function<descriptor::Matmul, Functor_, LHS, RHS>> : std::true_type {};
+
+	/// Evaluates as true if T is a Function which cannot be evaluated element by element
+	/// \tparam T The type to check
+	template<typename T>
+	struct IsNonTrivialFunction : std::false_type {};
+
+	template<typename desc, typename Functor_, typename... Args>
+	struct IsNonTrivialFunction<Function<desc, Functor_, Args...>>
+			: std::bool_constant<!std::is_same_v<desc, descriptor::Trivial>> {};
+
+	/// Counts the matrix multiplications which are only separated from the root of an expression
+	/// by element-wise operations. These can be evaluated with the rest of the expression as
+	/// their epilogue.
+	/// \tparam T The expression type
+	template<typename T>
+	struct NumFusibleMatmuls {
+		static constexpr int64_t value = IsMatmulFunction<T>::value ? 1 : 0;
+	};
+
+	template<typename Functor_, typename... Args>
+	struct NumFusibleMatmuls<Function<descriptor::Combined, Functor_, Args...>> {
+		static constexpr int64_t value =
+		  (NumFusibleMatmuls<std::decay_t<Args>>::value + ... + 0);
+	};
+
+	template<bool FuseMatmul, typename Functor_, typename... Args, typename Out, size_t... I>
+	LIBRAPID_NODISCARD auto
+	flattenCombined(const Function<descriptor::Combined, Functor_, Args...> &function,
+					const Out &out, std::index_sequence<I...>);
+
+	/// Convert an argument of a Combined Function into one which can be evaluated element by
+	/// element. Combined Functions are flattened recursively, and other non-trivial operations
+	/// are evaluated into temporary arrays. If \p FuseMatmul is set, matrix multiplications
+	/// are instead replaced by \p out, which must already hold their result.
+	/// \tparam FuseMatmul If true, matrix multiplications are replaced by \p out
+	/// \tparam T The type of the argument
+	/// \tparam Out The type of the destination array
+	/// \param expr The argument
+	/// \param out The destination array
+	/// \return A reference to the argument, a temporary array or a flattened Function
+	template<bool FuseMatmul, typename T, typename Out>
+	LIBRAPID_NODISCARD decltype(auto) flattenExpression(const T &expr, const Out &out) {
+		if constexpr (FuseMatmul && IsMatmulFunction<T>::value) {
+			return out;
+		} else if constexpr (IsCombinedFunction<T>::value) {
+			constexpr size_t numArgs =
+			  std::tuple_size_v<std::decay_t<decltype(expr.args())>>;
+			return flattenCombined<FuseMatmul>(expr, out, std::make_index_sequence<numArgs>());
+		} else if constexpr (IsNonTrivialFunction<T>::value) {
+			return evalTemporary(expr);
+		} else {
+			return expr;
+		}
+	}
+
+	/// Convert a Combined Function into a Trivial one by flattening each of its arguments
+	/// \see flattenExpression
+	template<bool FuseMatmul, typename Functor_, typename... Args, typename Out, size_t... I>
+	auto flattenCombined(const Function<descriptor::Combined, Functor_, Args...> &function,
+						 const Out &out, std::index_sequence<I...>) {
+		using Flat = Function<descriptor::Trivial,
+							  Functor_,
+							  decltype(flattenExpression<FuseMatmul>(std::get<I>(function.args()),
+																	 out))...>;
+		return Flat(Functor_(function.functor()),
+					flattenExpression<FuseMatmul>(std::get<I>(function.args()), out)...);
+	}
+
+	/// Call \p callback with each matrix multiplication counted by NumFusibleMatmuls
+	/// \tparam T The expression type
+	/// \tparam Callback The callback type
+	/// \param expr The expression
+	/// \param callback The callback
+	template<typename T, typename Callback>
+	LIBRAPID_ALWAYS_INLINE void visitFusibleMatmuls(const T &expr, Callback &&callback) {
+		if constexpr (IsMatmulFunction<T>::value) {
+			callback(expr);
+		} else if constexpr (IsCombinedFunction<T>::value) {
+			std::apply([&](const auto &...args) { (visitFusibleMatmuls(args, callback), ...); },
+					   expr.args());
+		}
+	}
+
+	/// Returns true if evaluating the element-wise part of an expression could read from
+	/// \p data, other than through a matrix multiplication. Views are assumed to alias it.
+	/// \tparam T The expression type
+	/// \param expr The expression
+	/// \param data The memory to check for
+	/// \return True if the expression may read from \p data
+	template<typename T, typename Scalar>
+	LIBRAPID_NODISCARD bool epilogueMayRead(const T &expr, const Scalar *data) {
+		if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::ArrayContainer) {
+			return static_cast<const void *>(expr.storage().begin()) ==
+				   static_cast<const void *>(data);
+		} else if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::ArrayView) {
+			return true;
+		} else if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::ArrayFunction &&
+							 !IsMatmulFunction<T>::value) {
+			return std::apply(
+			  [&](const auto &...args) { return (epilogueMayRead(args, data) || ... || false); },
+			  expr.args());
+		} else {
+			return false;
+		}
+	}
+
+	/// Evaluate the elements [begin, begin + length) of an element-wise Function into \p dst
+	/// \tparam Scalar The scalar type of the result
+	/// \tparam FunctionType The type of the Function
+	/// \param dst The memory to write the result to (indexed from the start of the result)
+	/// \param function The Function to evaluate
+	/// \param begin The first index to evaluate
+	/// \param length The number of elements to evaluate
+	template<typename Scalar, typename FunctionType>
+	LIBRAPID_ALWAYS_INLINE void assignRange(Scalar *dst, const FunctionType &function,
+											int64_t begin, int64_t length) {
+		constexpr int64_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+		constexpr bool allowVectorisation =
+		  typetraits::TypeInfo<FunctionType>::allowVectorisation;
+
+		const int64_t end = begin + length;
+		int64_t index	  = begin;
+
+		if constexpr (allowVectorisation) {
+			for (; index + packetWidth <= end; index += packetWidth) {
+				function.packet(index).store(dst + index);
+			}
+		}
+
+		for (; index < end; ++index) { dst[index] = function.scalar(index); }
+	}
+
+	/// Evaluate a Combined Function into \p lhs. If the expression is a matrix multiplication
+	/// followed by element-wise operations (such as max(matmul(a, b) + bias, 0)), the
+	/// multiplication is written directly to \p lhs and the element-wise operations are applied
+	/// to each tile of the result as the GEMM's epilogue, while the tile is still in cache.
+	/// Otherwise (or if any part of the expression reads \p lhs), each non-trivial operation is
+	/// evaluated into a temporary array, and the remaining element-wise operations are assigned
+	/// as usual.
+	/// \tparam Container The type of the array container
+	/// \tparam Functor_ The functor type
+	/// \tparam Args The argument types of the function
+	/// \param lhs The array container to assign to
+	/// \param function The function to assign
+	/// \param parallel If true, the element-wise operations are evaluated in parallel
+	template<typename Container, typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assignCombined(Container &lhs,
+				   const detail::Function<descriptor::Combined, Functor_, Args...> &function,
+				   bool parallel) {
+		using FunctionType		 = detail::Function<descriptor::Combined, Functor_, Args...>;
+		using Scalar			 = typename Container::Scalar;
+		constexpr size_t numArgs = sizeof...(Args);
+
+		static_assert(std::is_same_v<Scalar, typename FunctionType::Scalar>,
+					  "Function return type must be the same as the array's scalar type");
+		LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+
+		if constexpr (NumFusibleMatmuls<FunctionType>::value == 1) {
+			Scalar *dst = lhs.storage().begin();
+			bool fused	= false;
+
+			visitFusibleMatmuls(function, [&](const auto &matmul) {
+				using MatmulType = std::decay_t<decltype(matmul)>;
+				using ShapeType	 = typename MatmulType::ShapeType;
+				if constexpr (std::is_same_v<typename MatmulType::Scalar, Scalar>) {
+					// The product must not be broadcast, the epilogue must not read the memory
+					// the product is written to, and neither must the product itself -- the GEMM
+					// writes tiles of the result while it is still reading its operands
+					if (ShapeType(function.shape()) != matmul.shape() ||
+						epilogueMayRead(function, dst) ||
+						mayAlias(matmul, storageRange(lhs.storage()))) {
+						return;
+					}
+
+					const auto epilogue = flattenCombined<true>(
+					  function, lhs, std::make_index_sequence<numArgs>());
+					assignMatmul(dst, matmul, [&](Scalar *tile, int64_t rows, int64_t cols,
+												  int64_t ld) {
+						const int64_t offset = tile - dst;
+						for (int64_t row = 0; row < rows; ++row) {
+							assignRange(dst, epilogue, offset + row * ld, cols);
+						}
+					});
+					fused = true;
+				}
+			});
+
+			if (fused) return;
+		}
+
+		const auto flat =
+		  flattenCombined<false>(function, lhs, std::make_index_sequence<numArgs>());
+		if (parallel) {
+			assignParallel(lhs, flat);
+		} else {
+			assign(lhs, flat);
+		}
+	}
+
+	/// Combined assignment -- see assignCombined
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam StorageAllocator The Allocator of the Storage object
+	/// \tparam Functor_ The functor type
+	/// \tparam Args The argument types of the function
+	/// \param lhs The array container to assign to
+	/// \param function The function to assign
+	template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+			 typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		   const detail::Function<descriptor::Combined, Functor_, Args...> &function) {
+		assignCombined(lhs, function, false);
+	}
+
+	/// Combined assignment with fixed-size arrays
+	/// \see assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>>
+	/// &lhs, const detail::Function<descriptor::Combined, Functor_, Args...> &function)
+	template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+			 typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void
+	assign(array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		   const detail::Function<descriptor::Combined, Functor_, Args...> &function) {
+		assignCombined(lhs, function, false);
+	}
+
+	/// Combined assignment with parallel execution
+	/// \see assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>>
+	/// &lhs, const detail::Function<descriptor::Combined, Functor_, Args...> &function)
+	template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+			 typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void assignParallel(
+	  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+	  const detail::Function<descriptor::Combined, Functor_, Args...> &function) {
+		assignCombined(lhs, function, true);
+	}
+
+	/// Combined assignment with fixed-size arrays and parallel execution
+	/// \see assignParallel(array::ArrayContainer<ShapeType_, Storage<StorageScalar,
+	/// StorageAllocator>> &lhs, const detail::Function<descriptor::Combined, Functor_,
+	/// Args...> &function)
+	template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+			 typename Functor_, typename... Args>
+	LIBRAPID_ALWAYS_INLINE void assignParallel(
+	  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+	  const detail::Function<descriptor::Combined, Functor_, Args...> &function) {
+		assignCombined(lhs, function, true);
+	}
+} // namespace librapid::detail
+
+#endif // LIBRAPID_ARRAY_COMBINED_ASSIGN_HPP
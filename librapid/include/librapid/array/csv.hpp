@@ -0,0 +1,159 @@
+#ifndef LIBRAPID_ARRAY_CSV_HPP
+#define LIBRAPID_ARRAY_CSV_HPP
+
+/*
+ * Parsing delimited text files (see ArrayContainer::fromCSV). The file is memory-mapped and
+ * split into one part per thread at line boundaries. Each part is scanned once to count its
+ * rows, which gives the row each part starts at, and then every part is parsed straight into
+ * the storage of the result in parallel.
+ */
+
+namespace librapid {
+	/// Options for ArrayContainer::fromCSV()
+	struct CSVOptions {
+		char delimiter	 = ','; // The character separating the values in each row
+		char comment	 = '#'; // Lines starting with this character are ignored
+		int64_t skipRows = 0;	// The number of lines (e.g. column titles) to skip
+	};
+
+	namespace detail {
+		/// Text files smaller than this (in bytes) are parsed by a single thread
+		constexpr size_t csvParallelBytes = 1024 * 1024;
+
+		/// A range of a text file holding whole rows, and the index of its first row
+		struct CSVPart {
+			size_t begin;	  // The offset of the first byte
+			size_t end;		  // The offset one past the last byte
+			int64_t firstRow; // The index of the first row in the part
+		};
+
+		/// The layout of a text file, as found by scanCSV()
+		struct CSVLayout {
+			int64_t rows = 0;			// The total number of rows
+			int64_t cols = 0;			// The number of values in each row
+			std::vector<CSVPart> parts; // The ranges of the file to parse
+		};
+
+		/// Find the next row of values in a text file. Blank lines and comments are skipped,
+		/// and line endings (including "\r\n") are not included in the row.
+		/// \param cursor The position to search from, which is moved past the row
+		/// \param end The end of the text
+		/// \param options The parsing options
+		/// \param rowBegin Set to the first character of the row
+		/// \param rowEnd Set to one past the last character of the row
+		/// \return False if there are no more rows
+		LIBRAPID_ALWAYS_INLINE bool nextCSVRow(const char *&cursor, const char *end,
+											   const CSVOptions &options, const char *&rowBegin,
+											   const char *&rowEnd) {
+			while (cursor < end) {
+				const char *lineBegin = cursor;
+				const auto *newline =
+				  static_cast<const char *>(std::memchr(cursor, '\n', end - cursor));
+				const char *lineEnd = newline == nullptr ? end : newline;
+				cursor				= newline == nullptr ? end : newline + 1;
+				if (lineEnd > lineBegin && lineEnd[-1] == '\r') --lineEnd;
+
+				const char *first = lineBegin;
+				while (first < lineEnd && (*first == ' ' || *first == '\t')) ++first;
+				if (first == lineEnd || *first == options.comment) continue;
+
+				rowBegin = lineBegin;
+				rowEnd	 = lineEnd;
+				return true;
+			}
+			return false;
+		}
+
+		/// Split a text file into parts and count the rows and columns in it
+		/// \param text The contents of the file
+		/// \param bytes The length of the file, in bytes
+		/// \param options The parsing options
+		/// \param numParts The number of parts to split the file into
+		/// \return The layout of the file
+		LIBRAPID_NODISCARD CSVLayout scanCSV(const char *text, size_t bytes,
+											 const CSVOptions &options, int64_t numParts);
+
+		/// Parse a single value, which must occupy the whole of [first, last)
+		/// \tparam Scalar The type of the value
+		/// \param first The first character
+		/// \param last One past the last character
+		/// \param value Set to the parsed value
+		/// \return True if the value was parsed
+		template<typename Scalar>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool parseCSVValue(const char *first,
+																	 const char *last,
+																	 Scalar &value) {
+			static_assert(std::is_arithmetic_v<Scalar> && !std::is_same_v<Scalar, bool>,
+						  "Only integer and floating point arrays can be loaded from text");
+
+			// from_chars does not accept an explicit plus sign
+			if (first != last && *first == '+') ++first;
+
+			if constexpr (std::is_integral_v<Scalar>) {
+				const auto [ptr, error] = std::from_chars(first, last, value);
+				return error == std::errc() && ptr == last;
+			} else {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+				const auto [ptr, error] = std::from_chars(first, last, value);
+				return error == std::errc() && ptr == last;
+#else
+				// Not every standard library can parse floating point values with from_chars
+				const auto result = scn::scan_default(
+				  scn::string_view(first, static_cast<size_t>(last - first)), value);
+				return static_cast<bool>(result) && result.range().size() == 0;
+#endif
+			}
+		}
+
+		/// Parse the rows in one part of a text file
+		/// \tparam Scalar The type of the values
+		/// \param text The contents of the file
+		/// \param part The part of the file to parse
+		/// \param cols The number of values in each row
+		/// \param options The parsing options
+		/// \param dst The first element of the result
+		/// \return An empty string on success, otherwise a description of the error
+		template<typename Scalar>
+		LIBRAPID_NODISCARD std::string parseCSVPart(const char *text, const CSVPart &part,
+													 int64_t cols, const CSVOptions &options,
+													 Scalar *dst) {
+			const char *cursor = text + part.begin;
+			const char *end	   = text + part.end;
+			const char *rowBegin;
+			const char *rowEnd;
+			int64_t row = part.firstRow;
+
+			while (nextCSVRow(cursor, end, options, rowBegin, rowEnd)) {
+				const char *field = rowBegin;
+				Scalar *out		  = dst + row * cols;
+
+				for (int64_t col = 0; col < cols; ++col) {
+					const auto *delimiter = static_cast<const char *>(
+					  std::memchr(field, options.delimiter, rowEnd - field));
+					const char *fieldEnd = delimiter == nullptr ? rowEnd : delimiter;
+
+					if ((delimiter == nullptr) != (col == cols - 1)) {
+						return fmt::format("Row {} does not contain {} values", row + 1, cols);
+					}
+
+					const char *first = field;
+					const char *last  = fieldEnd;
+					while (first < last && (*first == ' ' || *first == '\t')) ++first;
+					while (last > first && (last[-1] == ' ' || last[-1] == '\t')) --last;
+
+					if (!parseCSVValue(first, last, out[col])) {
+						return fmt::format("Invalid value \"{}\" in row {}, column {}",
+										   std::string(first, last),
+										   row + 1,
+										   col + 1);
+					}
+					field = fieldEnd + 1;
+				}
+				++row;
+			}
+			return {};
+		}
+	} // namespace detail
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_CSV_HPP
@@ -192,6 +192,7 @@ namespace librapid {
 		T *__restrict cudaSafeAllocate(size_t size) {
 			static_assert(typetraits::TriviallyDefaultConstructible<T>::value,
 						  "Data type must be trivially constructable for use with CUDA");
+			memoryPool::detail::retainDeviceMemory();
 			T *result;
 			cudaSafeCall(cudaMallocAsync(&result, sizeof(T) * size, global::cudaStream));
 			return result;
@@ -2,15 +2,27 @@
 #define LIBRAPID_ARRAY_FUNCTION_HPP
 
 namespace librapid {
+	namespace detail {
+		template<typename First, typename... Rest>
+		constexpr auto scalarTypesAreSame();
+	} // namespace detail
+
 	namespace typetraits {
-		// Extract allowVectorisation from the input types
-		template<typename First, typename... T>
-		constexpr bool checkAllowVectorisation() {
+		// Extract allowVectorisation from the input types, promoting each argument to Scalar
+		template<typename Scalar, typename First, typename... T>
+		constexpr bool checkAllowPromotedVectorisation() {
+			using Type		  = std::decay_t<First>;
+			using ValueScalar = typename TypeInfo<Type>::Scalar;
+
+			constexpr bool allow =
+			  TypeInfo<Type>::type == detail::LibRapidType::Scalar
+				? canPromoteScalar<ValueScalar, Scalar>()
+				: TypeInfo<Type>::allowVectorisation && canPromotePacket<ValueScalar, Scalar>();
+
 			if constexpr (sizeof...(T) == 0) {
-				return TypeInfo<std::decay_t<First>>::allowVectorisation;
+				return allow;
 			} else {
-				return TypeInfo<std::decay_t<First>>::allowVectorisation &&
-					   checkAllowVectorisation<T...>();
+				return allow && checkAllowPromotedVectorisation<Scalar, T...>();
 			}
 		}
 
@@ -38,17 +50,148 @@ namespace librapid {
 			using Device =
 			  decltype(commonDevice<Args...>()); // typename DeviceCheckAndExtract<Args...>::Device;
 
-			static constexpr bool allowVectorisation = checkAllowVectorisation<Args...>();
+			// Arguments of a different type are promoted to the result type packet-by-packet (see
+			// canPromotePacket), so sin(Array<int>) and Array<float> * 2.0 are still vectorised
+			static constexpr bool allowVectorisation =
+			  checkAllowPromotedVectorisation<Scalar, Args...>();
 
 			static constexpr bool supportsArithmetic = TypeInfo<Scalar>::supportsArithmetic;
 			static constexpr bool supportsLogical	 = TypeInfo<Scalar>::supportsLogical;
 			static constexpr bool supportsBinary	 = TypeInfo<Scalar>::supportsBinary;
 		};
+
+		/// Counts the number of arrays an expression reads from (each of which is a separate
+		/// memory stream when the expression is evaluated). Scalars are not counted.
+		/// \tparam T The expression type
+		template<typename T>
+		struct NumArraySources {
+			static constexpr int64_t value =
+			  TypeInfo<T>::type == detail::LibRapidType::Scalar ? 0 : 1;
+		};
+
+		template<typename desc, typename Functor_, typename... Args>
+		struct NumArraySources<::librapid::detail::Function<desc, Functor_, Args...>> {
+			static constexpr int64_t value = (NumArraySources<std::decay_t<Args>>::value + ... + 0);
+		};
 	} // namespace typetraits
 
 	namespace detail {
 		// Descriptor is defined in "forward.hpp"
 
+		/// Maps flat indices into the (broadcast) result of a Function onto flat indices into one
+		/// of its arguments. Dimensions of size one in the argument are given a stride of zero, so
+		/// broadcast data is read in place and never copied.
+		///
+		/// Contiguous output indices are grouped into blocks. Within a block, the argument's data
+		/// is either contiguous (so a Packet can be loaded directly) or constant (so a single
+		/// Scalar can be broadcast across a Packet).
+		class BroadcastIndexer {
+		public:
+			using ShapeType = Shape<size_t, 32>;
+
+			/// Default constructor -- the resulting indexer is the identity mapping
+			BroadcastIndexer() = default;
+
+			/// Construct an indexer mapping from \p outShape to \p srcShape. The shapes must be
+			/// broadcast-compatible, and \p outShape must be the result of the broadcast.
+			/// \param outShape The shape of the Function's result
+			/// \param srcShape The shape of the argument
+			BroadcastIndexer(const ShapeType &outShape, const ShapeType &srcShape);
+
+			/// Returns true if no broadcasting is required (the mapping is the identity)
+			/// \return True if the shapes match
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool trivial() const { return m_trivial; }
+
+			/// Returns the number of consecutive output elements in each block
+			/// \return The block size
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE size_t blockSize() const { return m_block; }
+
+			/// Returns true if each block maps to a single, repeated element of the argument. If
+			/// false, each block maps to contiguous elements of the argument.
+			/// \return True if the innermost output dimension is broadcast
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool blockIsConstant() const {
+				return m_constantBlock;
+			}
+
+			/// Map an index into the output onto an index into the argument
+			/// \param index The index into the output
+			/// \return The corresponding index into the argument
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE size_t operator()(size_t index) const;
+
+		private:
+			bool m_trivial		 = true;  // Shapes match, so no mapping is required
+			bool m_periodic		 = false; // Argument repeats along (only) the leading dimensions
+			bool m_constantBlock = false; // Each block maps to a single element
+			size_t m_block		 = 1;	  // Length of a block of output elements
+			size_t m_period		 = 1;	  // Size of the argument if m_periodic is set
+			size_t m_dims		 = 0;	  // Number of output dimensions
+			std::array<size_t, 32> m_outDims {};   // Output dimensions
+			std::array<size_t, 32> m_srcStrides {}; // Argument strides (zero if broadcast)
+		};
+
+		inline BroadcastIndexer::BroadcastIndexer(const ShapeType &outShape,
+												  const ShapeType &srcShape) :
+				m_trivial(outShape == srcShape),
+				m_dims(outShape.ndim()) {
+			if (m_trivial) {
+				m_block = outShape.size();
+				return;
+			}
+
+			const size_t srcDims = srcShape.ndim();
+			LIBRAPID_ASSERT(srcDims <= m_dims, "Argument has more dimensions than the result");
+
+			// Compute the strides of the argument, aligned to the trailing dimensions of the
+			// output. Broadcast dimensions have a stride of zero
+			size_t stride = 1;
+			for (size_t i = 1; i <= m_dims; ++i) {
+				const size_t dim = m_dims - i;
+				const size_t src = i <= srcDims ? srcShape[srcDims - i] : 1;
+				m_outDims[dim]	 = outShape[dim];
+
+				LIBRAPID_ASSERT(src == outShape[dim] || src == 1,
+								"Shapes {} and {} cannot be broadcast together",
+								outShape.str(),
+								srcShape.str());
+
+				m_srcStrides[dim] = (src == 1 && outShape[dim] != 1) ? 0 : stride;
+				stride *= src;
+			}
+
+			// Find the longest run of trailing dimensions which are all broadcast, or all
+			// present in the argument. Dimensions of size one can belong to either
+			m_constantBlock = m_dims > 0 && m_outDims[m_dims - 1] != 1 &&
+							  m_srcStrides[m_dims - 1] == 0;
+			size_t i		= m_dims;
+			m_block			= 1;
+			while (i > 0) {
+				const bool broadcast = m_srcStrides[i - 1] == 0;
+				if (m_outDims[i - 1] != 1 && broadcast != m_constantBlock) break;
+				m_block *= m_outDims[--i];
+			}
+
+			// If the argument is simply repeated along the leading dimensions (e.g. adding a row
+			// vector to every row of a matrix), the mapping reduces to a single modulo
+			m_period   = m_block;
+			m_periodic = !m_constantBlock;
+			for (size_t j = 0; j < i; ++j) {
+				if (m_srcStrides[j] != 0 && m_outDims[j] != 1) m_periodic = false;
+			}
+		}
+
+		LIBRAPID_ALWAYS_INLINE size_t BroadcastIndexer::operator()(size_t index) const {
+			if (m_trivial) return index;
+			if (m_periodic) return index % m_period;
+
+			size_t res = 0;
+			for (size_t i = m_dims; i > 0; --i) {
+				const size_t dim = m_outDims[i - 1];
+				res += (index % dim) * m_srcStrides[i - 1];
+				index /= dim;
+			}
+			return res;
+		}
+
 		template<
 		  typename Packet, typename T,
 		  typename std::enable_if_t<
@@ -82,6 +225,165 @@ namespace librapid {
 			return obj;
 		}
 
+		/// Extract a Packet of contiguous elements from a Function argument, converting them to
+		/// the Packet's scalar type if the argument is of a different type. Arrays are loaded
+		/// with a converting load. Other arguments are converted with a Vc::simd_cast when the
+		/// packet widths match, and element by element otherwise, since loading a wider Packet
+		/// could read past the end of the argument.
+		/// \tparam Packet The packet type to extract
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param index The index of the first element
+		/// \return The extracted Packet
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet promotedPacketExtractor(const T &obj,
+																				 size_t index) {
+			using PacketScalar = typename Packet::EntryType;
+			using ValueScalar  = typename typetraits::TypeInfo<T>::Scalar;
+			using ValuePacket  = typename typetraits::TypeInfo<ValueScalar>::Packet;
+
+			if constexpr (std::is_same_v<ValueScalar, PacketScalar>) {
+				return packetExtractor<Packet>(obj, index);
+			} else if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::ArrayContainer) {
+				Packet res;
+				res.load(obj.storage().begin() + index);
+				return res;
+			} else if constexpr (ValuePacket::size() == Packet::size()) {
+				return Vc::simd_cast<Packet>(obj.packet(index));
+			} else {
+				Packet res;
+				for (size_t i = 0; i < Packet::size(); ++i) {
+					res[i] = static_cast<PacketScalar>(obj.scalar(index + i));
+				}
+				return res;
+			}
+		}
+
+		/// Extract a Packet from a Function argument, mapping the output index onto the argument
+		/// with \p indexer. Packets which lie within a single block of the broadcast are loaded
+		/// directly (or broadcast from a single Scalar), so the contiguous inner dimension keeps
+		/// its vectorised loads. Packets which straddle blocks are gathered lane by lane.
+		/// \tparam Packet The packet type to extract
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param indexer The broadcast mapping for the argument
+		/// \param index The index into the Function's result
+		/// \return The extracted Packet
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		packetExtractor(const T &obj, const BroadcastIndexer &indexer, size_t index) {
+			using PacketScalar = typename Packet::EntryType;
+
+			if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::Scalar) {
+				return Packet(static_cast<PacketScalar>(obj));
+			} else {
+				if (indexer.trivial()) return promotedPacketExtractor<Packet>(obj, index);
+
+				const size_t block = indexer.blockSize();
+				if (index % block + Packet::size() <= block) {
+					if (indexer.blockIsConstant()) {
+						return Packet(static_cast<PacketScalar>(obj.scalar(indexer(index))));
+					}
+					return promotedPacketExtractor<Packet>(obj, indexer(index));
+				}
+
+				Packet res;
+				for (size_t i = 0; i < Packet::size(); ++i) {
+					res[i] = static_cast<PacketScalar>(obj.scalar(indexer(index + i)));
+				}
+				return res;
+			}
+		}
+
+		/// True if packets of a Function argument can be read with aligned loads: the argument
+		/// is a CPU array, or an element-wise Function, of the same scalar type as \p Packet
+		/// \tparam Packet The packet type to extract
+		/// \tparam T The argument type
+		template<typename Packet, typename T>
+		struct HasAlignedPackets : std::false_type {};
+
+		template<typename Packet, typename ShapeType_, typename StorageType_>
+		struct HasAlignedPackets<Packet, array::ArrayContainer<ShapeType_, StorageType_>>
+				: std::bool_constant<
+					std::is_same_v<typename StorageType_::Scalar, typename Packet::EntryType> &&
+					std::is_same_v<typename typetraits::TypeInfo<StorageType_>::Device,
+								   device::CPU>> {};
+
+		template<typename Packet, typename Functor_, typename... Args>
+		struct HasAlignedPackets<Packet, Function<descriptor::Trivial, Functor_, Args...>>
+				: std::bool_constant<std::is_same_v<
+					typename Function<descriptor::Trivial, Functor_, Args...>::Scalar,
+					typename Packet::EntryType>> {};
+
+		/// Return true if alignedPacketExtractor() can use aligned loads for every array read by
+		/// a Function argument at \p index. The destination of an assignment is aligned at each
+		/// packet after the peeled head, but its sources are only aligned there if they start at
+		/// the same offset from a packet boundary.
+		/// \tparam Packet The packet type to extract
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param indexer The broadcast mapping for the argument
+		/// \param index The index into the Function's result
+		/// \return True if the packet at \p index can be loaded with aligned loads
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+		packetIsAligned(const T &obj, const BroadcastIndexer &indexer, size_t index) {
+			if constexpr (HasAlignedPackets<Packet, T>::value) {
+				if (indexer.trivial()) return obj.packetIsAligned(index);
+			}
+			return true;
+		}
+
+		/// Extract a Packet from a Function argument with an aligned load, if the argument
+		/// supports one and is read element for element. Anything else is extracted exactly as
+		/// packetExtractor() does. packetIsAligned() must have returned true for \p index.
+		/// \tparam Packet The packet type to extract
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param indexer The broadcast mapping for the argument
+		/// \param index The index into the Function's result
+		/// \return The extracted Packet
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		alignedPacketExtractor(const T &obj, const BroadcastIndexer &indexer, size_t index) {
+			if constexpr (HasAlignedPackets<Packet, T>::value) {
+				if (indexer.trivial()) return obj.packetAligned(index);
+			}
+			return packetExtractor<Packet>(obj, indexer, index);
+		}
+
+		/// Extract a Scalar from a Function argument, mapping the output index onto the argument
+		/// with \p indexer.
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param indexer The broadcast mapping for the argument
+		/// \param index The index into the Function's result
+		/// \return The extracted Scalar
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+		scalarExtractor(const T &obj, const BroadcastIndexer &indexer, size_t index) {
+			if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::Scalar) {
+				return obj;
+			} else {
+				return obj.scalar(indexer(index));
+			}
+		}
+
+		/// Construct the broadcast mapping for a single Function argument
+		/// \tparam T The argument type
+		/// \param obj The argument
+		/// \param outShape The shape of the Function's result
+		/// \return The broadcast mapping
+		template<typename T>
+		LIBRAPID_NODISCARD BroadcastIndexer
+		makeBroadcastIndexer(const T &obj, const Shape<size_t, 32> &outShape) {
+			if constexpr (typetraits::TypeInfo<T>::type == LibRapidType::Scalar) {
+				return {};
+			} else {
+				return BroadcastIndexer(outShape, obj.shape());
+			}
+		}
+
 		template<typename First, typename... Rest>
 		constexpr auto scalarTypesAreSame() {
 			if constexpr (sizeof...(Rest) == 0) {
@@ -99,6 +401,88 @@ namespace librapid {
 			}
 		}
 
+		/// The largest number of elements evaluated in a single tile (see Function::evaluateTile)
+		constexpr int64_t maxTileElements = 2048;
+
+		/// Storage for a tile of a Function argument. Only Function arguments are evaluated into
+		/// a buffer -- arrays are read in place, and scalars are broadcast.
+		/// \tparam T The argument type
+		template<typename T, typename = void>
+		struct TileBuffer {
+			static constexpr bool materialise = false;
+		};
+
+		template<typename T>
+		struct TileBuffer<T, std::enable_if_t<typetraits::TypeInfo<T>::type ==
+											  LibRapidType::ArrayFunction>> {
+			static constexpr bool materialise = true;
+
+			// User-provided so the buffer is not zeroed when the tuple holding it is constructed
+			TileBuffer() {}
+
+			alignas(64) typename typetraits::TypeInfo<T>::Scalar data[maxTileElements];
+		};
+
+		/// Evaluate a tile of a Function argument into its buffer, if it has one and it does not
+		/// need to be broadcast
+		/// \tparam T The argument type
+		/// \tparam Buffer The buffer type
+		/// \param obj The argument
+		/// \param indexer The broadcast mapping for the argument
+		/// \param buffer The buffer to evaluate into
+		/// \param begin The first index of the tile
+		/// \param length The number of elements in the tile
+		/// \return True if the tile was written to the buffer
+		template<typename T, typename Buffer>
+		LIBRAPID_ALWAYS_INLINE bool fillTileBuffer(const T &obj, const BroadcastIndexer &indexer,
+												   Buffer &buffer, size_t begin, size_t length) {
+			if constexpr (Buffer::materialise) {
+				if (indexer.trivial()) {
+					obj.evaluateTile(begin, length, buffer.data);
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// Extract a Packet from a Function argument within a tile, reading from the argument's
+		/// buffer if it was evaluated into one
+		/// \tparam Packet The packet type to extract
+		/// \tparam T The argument type
+		/// \tparam Buffer The buffer type
+		/// \param obj The argument
+		/// \param indexer The broadcast mapping for the argument
+		/// \param buffer The argument's buffer
+		/// \param buffered True if the argument was evaluated into \p buffer
+		/// \param begin The first index of the tile
+		/// \param index The index within the tile
+		/// \return The extracted Packet
+		template<typename Packet, typename T, typename Buffer>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		tilePacketExtractor(const T &obj, const BroadcastIndexer &indexer, const Buffer &buffer,
+							bool buffered, size_t begin, size_t index) {
+			if constexpr (Buffer::materialise) {
+				if (buffered) {
+					Packet res;
+					res.load(buffer.data + index);
+					return res;
+				}
+			}
+			return packetExtractor<Packet>(obj, indexer, begin + index);
+		}
+
+		/// Extract a Scalar from a Function argument within a tile
+		/// \see tilePacketExtractor
+		template<typename T, typename Buffer>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+		tileScalarExtractor(const T &obj, const BroadcastIndexer &indexer, const Buffer &buffer,
+							bool buffered, size_t begin, size_t index) {
+			if constexpr (Buffer::materialise) {
+				if (buffered) return buffer.data[index];
+			}
+			return scalarExtractor(obj, indexer, begin + index);
+		}
+
 		// template<typename First, typename... Rest>
 		// constexpr bool scalarTypesAreSame(const std::tuple<First, Rest...> &tup) {
 		// 	constexpr auto ret = scalarTypesAreSameImpl(tup);
@@ -153,6 +537,10 @@ namespace librapid {
 			/// \return The arguments in the Function
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto &args() const;
 
+			/// Return the functor applied by the Function
+			/// \return The functor
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Functor &functor() const;
+
 			/// Return an evaluated Array object
 			/// \return
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto eval() const;
@@ -164,11 +552,36 @@ namespace librapid {
 			/// \return The result of the function (vectorized).
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
 
+			/// Evaluates the function at the given index, returning a Packet result. Arrays read
+			/// element for element are loaded with aligned loads, so packetIsAligned() must
+			/// return true for \p index.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (vectorized).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetAligned(size_t index) const;
+
+			/// Return true if every array read element for element by the Function is aligned to
+			/// the size of a Packet at \p index, so packetAligned() can be used
+			/// \param index The index to check.
+			/// \return True if the packet at \p index can be loaded with aligned loads
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool packetIsAligned(size_t index) const;
+
 			/// Evaluates the function at the given index, returning a Scalar result.
 			/// \param index The index to evaluate at.
 			/// \return The result of the function (scalar).
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalar(size_t index) const;
 
+			/// Evaluate a contiguous range of the Function's result into \p dst. Rather than
+			/// evaluating the whole expression tree packet by packet, each Function argument is
+			/// first evaluated into a tile-sized buffer, and this Function's operation is then
+			/// applied to the buffers. Each pass over the tile reads from at most one location per
+			/// argument, so the working set stays in cache however many arrays the expression
+			/// reads from.
+			/// \param begin The first index to evaluate.
+			/// \param length The number of elements to evaluate (at most maxTileElements).
+			/// \param dst The memory to write the result to.
+			LIBRAPID_ALWAYS_INLINE void evaluateTile(size_t begin, size_t length,
+													 Scalar *dst) const;
+
 			/// Return a string representation of the Function
 			/// \param format The format to use.
 			/// \return A string representation of the Function
@@ -184,6 +597,23 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetImpl(std::index_sequence<I...>,
 																		size_t index) const;
 
+			/// Implementation detail -- evaluates the function at the given index with aligned
+			/// loads, returning a Packet result.
+			/// \tparam I The index sequence.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (vectorized).
+			template<size_t... I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+			packetAlignedImpl(std::index_sequence<I...>, size_t index) const;
+
+			/// Implementation detail -- checks the alignment of every argument at \p index.
+			/// \tparam I The index sequence.
+			/// \param index The index to check.
+			/// \return True if every argument can be loaded with aligned loads at \p index
+			template<size_t... I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool
+			packetIsAlignedImpl(std::index_sequence<I...>, size_t index) const;
+
 			/// Implementation detail -- evaluates the function at the given index,
 			/// returning a Scalar result.
 			/// \tparam I The index sequence.
@@ -193,13 +623,39 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalarImpl(std::index_sequence<I...>,
 																		size_t index) const;
 
+			/// Implementation detail -- evaluates a tile of the Function's result.
+			/// \tparam I The index sequence.
+			/// \param begin The first index to evaluate.
+			/// \param length The number of elements to evaluate.
+			/// \param dst The memory to write the result to.
+			template<size_t... I>
+			LIBRAPID_ALWAYS_INLINE void evaluateTileImpl(std::index_sequence<I...>, size_t begin,
+														 size_t length, Scalar *dst) const;
+
+			/// Implementation detail -- constructs the broadcast mapping for each argument.
+			/// \tparam I The index sequence.
+			/// \return An array of BroadcastIndexer objects, one per argument.
+			template<size_t... I>
+			LIBRAPID_NODISCARD auto makeIndexers(std::index_sequence<I...>) const
+			  -> std::array<BroadcastIndexer, sizeof...(Args)>;
+
 			Functor m_functor;
 			std::tuple<Args...> m_args;
+			std::array<BroadcastIndexer, sizeof...(Args)> m_broadcast;
 		};
 
 		template<typename desc, typename Functor, typename... Args>
 		Function<desc, Functor, Args...>::Function(Functor &&functor, Args &&...args) :
-				m_functor(std::forward<Functor>(functor)), m_args(std::forward<Args>(args)...) {}
+				m_functor(std::forward<Functor>(functor)), m_args(std::forward<Args>(args)...),
+				m_broadcast(makeIndexers(std::make_index_sequence<sizeof...(Args)>())) {}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		auto Function<desc, Functor, Args...>::makeIndexers(std::index_sequence<I...>) const
+		  -> std::array<BroadcastIndexer, sizeof...(Args)> {
+			const ShapeType outShape = shape();
+			return {makeBroadcastIndexer(std::get<I>(m_args), outShape)...};
+		}
 
 		template<typename desc, typename Functor, typename... Args>
 		auto Function<desc, Functor, Args...>::shape() const {
@@ -212,11 +668,30 @@ namespace librapid {
 			return m_args;
 		}
 
+		template<typename desc, typename Functor, typename... Args>
+		const Functor &Function<desc, Functor, Args...>::functor() const {
+			return m_functor;
+		}
+
 		template<typename desc, typename Functor, typename... Args>
 		auto Function<desc, Functor, Args...>::operator[](int64_t index) const {
 			return array::ArrayView(*this)[index];
 		}
 
+		/// Evaluate an array or expression into a TemporaryArray. Use this rather than eval()
+		/// for results which are only needed until the calling function returns.
+		/// \tparam T The type of the expression
+		/// \param expr The expression to evaluate
+		/// \return The evaluated expression
+		template<typename T>
+		LIBRAPID_NODISCARD auto evalTemporary(const T &expr) {
+			using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+			using Device = typename typetraits::TypeInfo<T>::Device;
+			TemporaryArray<Scalar, Device> res(expr.shape());
+			res = expr;
+			return res;
+		}
+
 		template<typename desc, typename Functor, typename... Args>
 		auto Function<desc, Functor, Args...>::eval() const {
 			Array<Scalar, Device> res(shape());
@@ -235,7 +710,37 @@ namespace librapid {
 		auto Function<desc, Functor, Args...>::packetImpl(std::index_sequence<I...>,
 														  size_t index) const -> Packet {
 			// return m_functor.packet((std::get<I>(m_args).packet(index))...);
-			return m_functor.packet(packetExtractor<Packet>(std::get<I>(m_args), index)...);
+			return m_functor.packet(
+			  packetExtractor<Packet>(std::get<I>(m_args), std::get<I>(m_broadcast), index)...);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		typename Function<desc, Functor, Args...>::Packet
+		Function<desc, Functor, Args...>::packetAligned(size_t index) const {
+			return packetAlignedImpl(std::make_index_sequence<sizeof...(Args)>(), index);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		auto Function<desc, Functor, Args...>::packetAlignedImpl(std::index_sequence<I...>,
+																 size_t index) const -> Packet {
+			return m_functor.packet(alignedPacketExtractor<Packet>(
+			  std::get<I>(m_args), std::get<I>(m_broadcast), index)...);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		bool Function<desc, Functor, Args...>::packetIsAligned(size_t index) const {
+			return packetIsAlignedImpl(std::make_index_sequence<sizeof...(Args)>(), index);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		bool Function<desc, Functor, Args...>::packetIsAlignedImpl(std::index_sequence<I...>,
+																   size_t index) const {
+			// Qualified, since the member function of the same name would hide it
+			return (detail::packetIsAligned<Packet>(
+					  std::get<I>(m_args), std::get<I>(m_broadcast), index) &&
+					...);
 		}
 
 		template<typename desc, typename Functor, typename... Args>
@@ -248,12 +753,56 @@ namespace librapid {
 		auto Function<desc, Functor, Args...>::scalarImpl(std::index_sequence<I...>,
 														  size_t index) const -> Scalar {
 			// return m_functor((std::get<I>(m_args).scalar(index))...);
-			return m_functor(scalarExtractor(std::get<I>(m_args), index)...);
+			return m_functor(
+			  scalarExtractor(std::get<I>(m_args), std::get<I>(m_broadcast), index)...);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		void Function<desc, Functor, Args...>::evaluateTile(size_t begin, size_t length,
+															Scalar *dst) const {
+			LIBRAPID_ASSERT(length <= static_cast<size_t>(maxTileElements),
+							"Tile length {} exceeds the maximum of {}",
+							length,
+							maxTileElements);
+			evaluateTileImpl(std::make_index_sequence<sizeof...(Args)>(), begin, length, dst);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		void Function<desc, Functor, Args...>::evaluateTileImpl(std::index_sequence<I...>,
+																size_t begin, size_t length,
+																Scalar *dst) const {
+			std::tuple<TileBuffer<std::decay_t<Args>>...> buffers;
+			const bool buffered[] = {fillTileBuffer(std::get<I>(m_args),
+													std::get<I>(m_broadcast),
+													std::get<I>(buffers),
+													begin,
+													length)...};
+
+			const size_t vectorLength = length - (length % Packet::size());
+			for (size_t i = 0; i < vectorLength; i += Packet::size()) {
+				Packet res = m_functor.packet(tilePacketExtractor<Packet>(std::get<I>(m_args),
+																		  std::get<I>(m_broadcast),
+																		  std::get<I>(buffers),
+																		  buffered[I],
+																		  begin,
+																		  i)...);
+				res.store(dst + i);
+			}
+
+			for (size_t i = vectorLength; i < length; ++i) {
+				dst[i] = m_functor(tileScalarExtractor(std::get<I>(m_args),
+													   std::get<I>(m_broadcast),
+													   std::get<I>(buffers),
+													   buffered[I],
+													   begin,
+													   i)...);
+			}
 		}
 
 		template<typename desc, typename Functor, typename... Args>
 		std::string Function<desc, Functor, Args...>::str(const std::string &format) const {
-			return eval().str(format);
+			return array::ArrayView(*this).str(format);
 		}
 	} // namespace detail
 } // namespace librapid
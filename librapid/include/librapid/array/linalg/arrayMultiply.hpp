@@ -0,0 +1,480 @@
+#ifndef LIBRAPID_ARRAY_LINALG_ARRAY_MULTIPLY_HPP
+#define LIBRAPID_ARRAY_LINALG_ARRAY_MULTIPLY_HPP
+
+namespace librapid {
+	namespace detail {
+		/// Functor for a matrix multiplication. The multiplication itself is handled by the
+		/// Matmul Function and its assignment operators, so the functor only defines the scalar
+		/// type of the result (that of a product of the elements).
+		struct Matmul {
+			template<typename LHS, typename RHS>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const LHS &lhs,
+																	  const RHS &rhs) const {
+				return lhs * rhs;
+			}
+		};
+	} // namespace detail
+
+	namespace typetraits {
+		template<>
+		struct TypeInfo<::librapid::detail::Matmul> {
+			static constexpr const char *name = "matmul";
+		};
+	} // namespace typetraits
+
+	namespace detail {
+		/// A lazily-evaluated matrix multiplication, following the same rules as NumPy's matmul.
+		/// A vector (1D) on the left is treated as a row vector and a vector on the right as a
+		/// column vector, and the corresponding dimension is removed from the result. Operands
+		/// with more than two dimensions are stacks of matrices: the leading dimensions form a
+		/// batch, which is broadcast between the operands. Element-wise access computes a single
+		/// dot product, but assigning the result to an array calls linalg::gemm (or
+		/// linalg::gemmBatched).
+		/// \tparam Functor_ The functor type (Matmul)
+		/// \tparam LHS The type of the left operand
+		/// \tparam RHS The type of the right operand
+		template<typename Functor_, typename LHS, typename RHS>
+		class Function<descriptor::Matmul, Functor_, LHS, RHS> {
+		public:
+			using Type		= Function<descriptor::Matmul, Functor_, LHS, RHS>;
+			using Functor	= Functor_;
+			using ShapeType = Shape<size_t, 32>;
+			using Scalar	= typename typetraits::TypeInfo<Type>::Scalar;
+			using Device	= typename typetraits::TypeInfo<Type>::Device;
+			using Packet	= typename typetraits::TypeInfo<Scalar>::Packet;
+
+			using Descriptor = descriptor::Matmul;
+
+			Function() = default;
+
+			/// Constructs a multiplication of \p lhs by \p rhs
+			/// \param functor The Matmul functor
+			/// \param lhs The left operand
+			/// \param rhs The right operand
+			LIBRAPID_ALWAYS_INLINE explicit Function(Functor &&functor, LHS &&lhs, RHS &&rhs);
+
+			LIBRAPID_ALWAYS_INLINE Function(const Function &other)				= default;
+			LIBRAPID_ALWAYS_INLINE Function(Function &&other) noexcept			= default;
+			LIBRAPID_ALWAYS_INLINE Function &operator=(const Function &other)	= default;
+			LIBRAPID_ALWAYS_INLINE Function &operator=(Function &&other) noexcept = default;
+
+			/// Return the shape of the product
+			/// \return The shape of the result
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto shape() const;
+
+			/// Return the arguments in the Function (the two operands)
+			/// \return The arguments in the Function
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto &args() const;
+
+			/// Return the number of rows in the product (1 if the left operand is a vector)
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t m() const { return m_m; }
+
+			/// Return the number of columns in the product (1 if the right operand is a vector)
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t n() const { return m_n; }
+
+			/// Return the length of the dimension being summed over
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t k() const { return m_k; }
+
+			/// Return the number of matrices in the product (1 if neither operand is batched)
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t batch() const { return m_batch; }
+
+			/// Compute the offsets of the matrices multiplied in a batch
+			/// \param batch The index of the batch
+			/// \param lhsOffset Set to the offset of the matrix in the left operand
+			/// \param rhsOffset Set to the offset of the matrix in the right operand
+			LIBRAPID_ALWAYS_INLINE void batchOffsets(int64_t batch, int64_t &lhsOffset,
+													 int64_t &rhsOffset) const;
+
+			/// Return an evaluated Array object
+			/// \return The product
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto eval() const;
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator[](int64_t index) const;
+
+			/// Evaluates the product at the given index, returning a Packet result. Each element
+			/// is a separate dot product, so they are computed one at a time.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (vectorized).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
+
+			/// Evaluates the product at the given index, returning a Scalar result.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (scalar).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalar(size_t index) const;
+
+			/// Return a string representation of the Function
+			/// \param format The format to use.
+			/// \return A string representation of the Function
+			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
+
+		private:
+			Functor m_functor;
+			std::tuple<LHS, RHS> m_args;
+			ShapeType m_shape;
+			int64_t m_m		= 0;
+			int64_t m_n		= 0;
+			int64_t m_k		= 0;
+			int64_t m_batch = 1;
+			ShapeType m_batchShape;
+			std::array<int64_t, 32> m_lhsBatchStride {}; // Zero if the dimension is broadcast
+			std::array<int64_t, 32> m_rhsBatchStride {}; // Zero if the dimension is broadcast
+		};
+
+		template<typename Functor, typename LHS, typename RHS>
+		Function<descriptor::Matmul, Functor, LHS, RHS>::Function(Functor &&functor, LHS &&lhs,
+																  RHS &&rhs) :
+				m_functor(std::forward<Functor>(functor)),
+				m_args(std::forward<LHS>(lhs), std::forward<RHS>(rhs)) {
+			const auto lhsShape = ShapeType(std::get<0>(m_args).shape());
+			const auto rhsShape = ShapeType(std::get<1>(m_args).shape());
+			const int64_t lhsDims = lhsShape.ndim();
+			const int64_t rhsDims = rhsShape.ndim();
+
+			LIBRAPID_ASSERT(lhsDims > 0 && rhsDims > 0, "Matmul operands cannot be scalars");
+
+			const bool lhsVector = lhsDims == 1;
+			const bool rhsVector = rhsDims == 1;
+			const int64_t rhsK	 = rhsVector ? rhsShape[0] : rhsShape[rhsDims - 2];
+
+			m_m = lhsVector ? 1 : lhsShape[lhsDims - 2];
+			m_k = lhsShape[lhsDims - 1];
+			m_n = rhsVector ? 1 : rhsShape[rhsDims - 1];
+
+			LIBRAPID_ASSERT(m_k == rhsK,
+							"Cannot multiply arrays with shapes {} and {}",
+							lhsShape.str(),
+							rhsShape.str());
+
+			// Broadcast the batch dimensions, aligning them from the right
+			const int64_t lhsBatchDims = lhsVector ? 0 : lhsDims - 2;
+			const int64_t rhsBatchDims = rhsVector ? 0 : rhsDims - 2;
+			const int64_t batchDims	   = std::max(lhsBatchDims, rhsBatchDims);
+			const Stride<size_t, 32> lhsStride(lhsShape);
+			const Stride<size_t, 32> rhsStride(rhsShape);
+
+			m_batchShape = ShapeType::zeros(batchDims);
+			for (int64_t i = 0; i < batchDims; ++i) {
+				const int64_t lhsIndex = i - (batchDims - lhsBatchDims);
+				const int64_t rhsIndex = i - (batchDims - rhsBatchDims);
+				const int64_t lhsDim   = lhsIndex < 0 ? 1 : lhsShape[lhsIndex];
+				const int64_t rhsDim   = rhsIndex < 0 ? 1 : rhsShape[rhsIndex];
+
+				LIBRAPID_ASSERT(lhsDim == rhsDim || lhsDim == 1 || rhsDim == 1,
+								"Cannot broadcast the batch dimensions of arrays with shapes {} "
+								"and {}",
+								lhsShape.str(),
+								rhsShape.str());
+
+				m_batchShape[i]		= std::max(lhsDim, rhsDim);
+				m_lhsBatchStride[i] = lhsDim == 1 ? 0 : lhsStride[lhsIndex];
+				m_rhsBatchStride[i] = rhsDim == 1 ? 0 : rhsStride[rhsIndex];
+			}
+			m_batch = m_batchShape.size();
+
+			m_shape = ShapeType::zeros(batchDims + int(!lhsVector) + int(!rhsVector));
+			for (int64_t i = 0; i < batchDims; ++i) { m_shape[i] = m_batchShape[i]; }
+			if (!lhsVector) m_shape[batchDims] = m_m;
+			if (!rhsVector) m_shape[m_shape.ndim() - 1] = m_n;
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		void Function<descriptor::Matmul, Functor, LHS, RHS>::batchOffsets(
+		  int64_t batch, int64_t &lhsOffset, int64_t &rhsOffset) const {
+			lhsOffset = 0;
+			rhsOffset = 0;
+			for (int64_t i = m_batchShape.ndim() - 1; i >= 0; --i) {
+				const int64_t coord = batch % m_batchShape[i];
+				batch /= m_batchShape[i];
+				lhsOffset += coord * m_lhsBatchStride[i];
+				rhsOffset += coord * m_rhsBatchStride[i];
+			}
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		auto Function<descriptor::Matmul, Functor, LHS, RHS>::shape() const {
+			return m_shape;
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		auto &Function<descriptor::Matmul, Functor, LHS, RHS>::args() const {
+			return m_args;
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		auto Function<descriptor::Matmul, Functor, LHS, RHS>::eval() const {
+			Array<Scalar, Device> res(shape());
+			res = *this;
+			return res;
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		auto Function<descriptor::Matmul, Functor, LHS, RHS>::operator[](int64_t index) const {
+			return array::ArrayView(*this)[index];
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		auto Function<descriptor::Matmul, Functor, LHS, RHS>::packet(size_t index) const
+		  -> Packet {
+			Packet res;
+			for (size_t i = 0; i < Packet::size(); ++i) { res[i] = scalar(index + i); }
+			return res;
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		auto Function<descriptor::Matmul, Functor, LHS, RHS>::scalar(size_t index) const
+		  -> Scalar {
+			const auto &lhs		 = std::get<0>(m_args);
+			const auto &rhs		 = std::get<1>(m_args);
+			const int64_t within = static_cast<int64_t>(index) % (m_m * m_n);
+			const int64_t row	 = within / m_n;
+			const int64_t col	 = within % m_n;
+
+			int64_t lhsOffset, rhsOffset;
+			batchOffsets(static_cast<int64_t>(index) / (m_m * m_n), lhsOffset, rhsOffset);
+			lhsOffset += row * m_k;
+			rhsOffset += col;
+
+			Scalar res(0);
+			for (int64_t i = 0; i < m_k; ++i) {
+				res += m_functor(lhs.scalar(lhsOffset + i), rhs.scalar(rhsOffset + i * m_n));
+			}
+			return res;
+		}
+
+		template<typename Functor, typename LHS, typename RHS>
+		std::string
+		Function<descriptor::Matmul, Functor, LHS, RHS>::str(const std::string &format) const {
+			return array::ArrayView(*this).str(format);
+		}
+
+		/// Evaluates as true if T is a lazily-evaluated transposition
+		/// \tparam T The type to check
+		template<typename T>
+		struct IsTransposeFunction : std::false_type {};
+
+		template<typename Functor_, typename Arg>
+		struct IsTransposeFunction<Function<descriptor::Transpose, Functor_, Arg>>
+				: std::true_type {};
+
+		/// Call \p callback with a pointer to the contiguous, row-major data of a matmul operand,
+		/// whether its matrices should be transposed, and the distance between their rows.
+		/// Arrays are used in place, as are transpositions which only swap the last two
+		/// dimensions (the transposition is passed on to gemm). Anything else is evaluated into
+		/// a temporary first (see evalTemporary).
+		/// \tparam T The type of the operand
+		/// \tparam Callback The type of the callback
+		/// \param operand The operand
+		/// \param isLhs True if the operand is the left operand
+		/// \param callback Called with (const Scalar *data, bool trans, int64_t ld)
+		template<typename T, typename Callback>
+		LIBRAPID_ALWAYS_INLINE void withMatmulOperand(const T &operand, bool isLhs,
+													  Callback &&callback) {
+			if constexpr (typetraits::typetraits::IsArrayContainer<T>::value) {
+				const auto shape  = operand.shape();
+				const int64_t dims = shape.ndim();
+				const int64_t ld   = dims >= 2 ? shape[dims - 1] : (isLhs ? shape[0] : 1);
+				callback(operand.storage().begin(), false, ld);
+			} else if constexpr (IsTransposeFunction<T>::value) {
+				using ArgType	= std::decay_t<std::tuple_element_t<0, std::decay_t<decltype(
+				  operand.args())>>>;
+				const auto &arg = std::get<0>(operand.args());
+
+				if constexpr (typetraits::typetraits::IsArrayContainer<ArgType>::value) {
+					const auto &axes   = operand.axes();
+					const int64_t dims = axes.ndim();
+
+					// A transposed vector is unchanged
+					if (dims == 1) {
+						withMatmulOperand(arg, isLhs, callback);
+						return;
+					}
+
+					bool batchUnchanged = true;
+					for (int64_t i = 0; i < dims - 2; ++i) {
+						batchUnchanged = batchUnchanged && static_cast<int64_t>(axes[i]) == i;
+					}
+
+					if (batchUnchanged) {
+						const bool swapped = static_cast<int64_t>(axes[dims - 1]) == dims - 2;
+						callback(arg.storage().begin(), swapped, arg.shape()[dims - 1]);
+					} else {
+						withMatmulOperand(evalTemporary(operand), isLhs, callback);
+					}
+				} else {
+					withMatmulOperand(evalTemporary(operand), isLhs, callback);
+				}
+			} else {
+				withMatmulOperand(evalTemporary(operand), isLhs, callback);
+			}
+		}
+
+		/// Evaluate a matrix multiplication into \p dst
+		/// \tparam Scalar The scalar type of the result
+		/// \tparam Functor_ The functor type (Matmul)
+		/// \tparam LHS The type of the left operand
+		/// \tparam RHS The type of the right operand
+		/// \tparam Epilogue The epilogue type (see GemmNoEpilogue)
+		/// \param dst The memory to write the result to
+		/// \param function The multiplication to evaluate
+		/// \param epilogue Called on each tile of the result once it is complete
+		template<typename Scalar, typename Functor_, typename LHS, typename RHS,
+				 typename Epilogue = GemmNoEpilogue>
+		LIBRAPID_ALWAYS_INLINE void
+		assignMatmul(Scalar *dst, const Function<descriptor::Matmul, Functor_, LHS, RHS> &function,
+					 const Epilogue &epilogue = Epilogue()) {
+			using FunctionType = Function<descriptor::Matmul, Functor_, LHS, RHS>;
+			using LhsScalar	   = typename typetraits::TypeInfo<std::decay_t<LHS>>::Scalar;
+			using RhsScalar	   = typename typetraits::TypeInfo<std::decay_t<RHS>>::Scalar;
+			static_assert(std::is_same_v<Scalar, typename FunctionType::Scalar>,
+						  "Function return type must be the same as the array's scalar type");
+			static_assert(std::is_same_v<LhsScalar, Scalar> && std::is_same_v<RhsScalar, Scalar>,
+						  "Matmul operands must have the same scalar type");
+
+			const int64_t m = function.m();
+			const int64_t n = function.n();
+			const int64_t k = function.k();
+
+			const int64_t batch = function.batch();
+
+			withMatmulOperand(
+			  std::get<0>(function.args()), true, [&](const Scalar *a, bool transA, int64_t lda) {
+				  withMatmulOperand(
+					std::get<1>(function.args()),
+					false,
+					[&](const Scalar *b, bool transB, int64_t ldb) {
+						if (batch == 1) {
+							linalg::gemm(transA,
+										 transB,
+										 m,
+										 n,
+										 k,
+										 Scalar(1),
+										 a,
+										 lda,
+										 b,
+										 ldb,
+										 Scalar(0),
+										 dst,
+										 n,
+										 epilogue);
+							return;
+						}
+
+						std::vector<const Scalar *> aPtrs(batch), bPtrs(batch);
+						std::vector<Scalar *> cPtrs(batch);
+						for (int64_t i = 0; i < batch; ++i) {
+							int64_t lhsOffset, rhsOffset;
+							function.batchOffsets(i, lhsOffset, rhsOffset);
+							aPtrs[i] = a + lhsOffset;
+							bPtrs[i] = b + rhsOffset;
+							cPtrs[i] = dst + i * m * n;
+						}
+
+						linalg::gemmBatched(transA,
+											transB,
+											m,
+											n,
+											k,
+											Scalar(1),
+											aPtrs.data(),
+											lda,
+											bPtrs.data(),
+											ldb,
+											Scalar(0),
+											cPtrs.data(),
+											n,
+											batch,
+											epilogue);
+					});
+			  });
+		}
+
+		/// Matmul assignment -- the product is computed by linalg::gemm, which decides whether
+		/// to use multiple threads based on global::gemmMultithreadThreshold. The GEMM writes
+		/// the result while it is still reading the operands, so if either of them shares memory
+		/// with \p lhs (as in a = matmul(a, b)), the product is computed into a temporary first.
+		/// \tparam ShapeType_ The shape type of the array container
+		/// \tparam StorageScalar The scalar type of the storage object
+		/// \tparam StorageAllocator The Allocator of the Storage object
+		/// \tparam Functor_ The functor type (Matmul)
+		/// \tparam Args The argument types of the function
+		/// \param lhs The array container to assign to
+		/// \param function The multiplication to assign
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+			   const detail::Function<descriptor::Matmul, Functor_, Args...> &function) {
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+			if (mayAlias(function, storageRange(lhs.storage()))) {
+				lhs = std::decay_t<decltype(lhs)>(function);
+				return;
+			}
+			assignMatmul(lhs.storage().begin(), function);
+		}
+
+		/// Matmul assignment with fixed-size arrays
+		/// \see assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>>
+		/// &lhs, const detail::Function<descriptor::Matmul, Functor_, Args...> &function)
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+			   const detail::Function<descriptor::Matmul, Functor_, Args...> &function) {
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+			if (mayAlias(function, storageRange(lhs.storage()))) {
+				lhs = std::decay_t<decltype(lhs)>(function);
+				return;
+			}
+			assignMatmul(lhs.storage().begin(), function);
+		}
+
+		/// Matmul assignment for large arrays. The threading of a matrix multiplication depends
+		/// on its dimensions rather than the number of elements in the result, so this is the
+		/// same as the serial version.
+		/// \see assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>>
+		/// &lhs, const detail::Function<descriptor::Matmul, Functor_, Args...> &function)
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const detail::Function<descriptor::Matmul, Functor_, Args...> &function) {
+			assign(lhs, function);
+		}
+
+		/// Matmul assignment for large fixed-size arrays
+		/// \see assignParallel(array::ArrayContainer<ShapeType_, Storage<StorageScalar,
+		/// StorageAllocator>> &lhs, const detail::Function<descriptor::Matmul, Functor_,
+		/// Args...> &function)
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		  const detail::Function<descriptor::Matmul, Functor_, Args...> &function) {
+			assign(lhs, function);
+		}
+	} // namespace detail
+
+	/// Multiply two matrices, vectors or stacks of matrices, following NumPy's matmul rules
+	/// (see detail::Function<descriptor::Matmul, ...>). The result is evaluated lazily, and
+	/// assigning it to an array calls linalg::gemm, or linalg::gemmBatched for stacks of
+	/// matrices. Transposed matrices are not copied -- the transposition is done by the GEMM.
+	/// \tparam LHS The type of the left operand
+	/// \tparam RHS The type of the right operand
+	/// \param lhs The left operand
+	/// \param rhs The right operand
+	/// \return A Function object representing the product
+	template<typename LHS, typename RHS,
+			 typename std::enable_if_t<typetraits::TypeInfo<std::decay_t<LHS>>::type !=
+										   ::librapid::detail::LibRapidType::Scalar &&
+										 typetraits::TypeInfo<std::decay_t<RHS>>::type !=
+										   ::librapid::detail::LibRapidType::Scalar,
+									   int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto matmul(LHS &&lhs, RHS &&rhs)
+	  -> detail::Function<detail::descriptor::Matmul, detail::Matmul, LHS, RHS> {
+		using FunctionType = detail::Function<detail::descriptor::Matmul, detail::Matmul, LHS, RHS>;
+		return FunctionType(detail::Matmul(), std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_ARRAY_MULTIPLY_HPP
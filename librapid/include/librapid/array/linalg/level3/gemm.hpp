@@ -0,0 +1,283 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_HPP
+
+namespace librapid {
+	namespace detail {
+		/// cxxblas only dispatches to an external BLAS library for int and long indices
+		using BlasIndex = long;
+
+		/// Convert a pointer to the type cxxblas expects. LibRapid's Complex type has the same
+		/// layout as std::complex, so complex arrays can be passed to BLAS directly.
+		/// \tparam T The scalar type
+		/// \param ptr The pointer to convert
+		/// \return The converted pointer
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T *blasPointer(T *ptr) {
+			return ptr;
+		}
+
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE std::complex<T> *blasPointer(Complex<T> *ptr) {
+			return reinterpret_cast<std::complex<T> *>(ptr);
+		}
+
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::complex<T> *
+		blasPointer(const Complex<T> *ptr) {
+			return reinterpret_cast<const std::complex<T> *>(ptr);
+		}
+
+		/// Convert a scalar to the type cxxblas expects
+		/// \see blasPointer
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const T &blasScalar(const T &val) {
+			return val;
+		}
+
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE std::complex<T>
+		blasScalar(const Complex<T> &val) {
+			return {val.real(), val.imag()};
+		}
+
+		/// Evaluates as true if cxxblas can pass a GEMM on this type to an external BLAS library
+		/// \tparam T The scalar type (after conversion with blasPointer)
+		template<typename T>
+		constexpr bool isBlasType =
+		  std::is_same_v<T, float> || std::is_same_v<T, double> ||
+		  std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>;
+
+		/// Returns true if a matrix multiplication producing an \p m x \p n result should use
+		/// multiple threads
+		/// \param m The number of rows in the result
+		/// \param n The number of columns in the result
+		/// \return True if the multiplication should be parallelised
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool gemmShouldParallelise(int64_t m, int64_t n) {
+			return global::numThreads > 1 && m >= global::gemmMultithreadThreshold &&
+				   n >= global::gemmMultithreadThreshold;
+		}
+
+		/// Set the number of threads used by the BLAS library, if it allows this
+		/// \param parallel If true, the BLAS library uses global::numThreads threads, otherwise one
+		LIBRAPID_ALWAYS_INLINE void setBlasThreads(bool parallel) {
+#if defined(LIBRAPID_BLAS_OPENBLAS)
+			openblas_set_num_threads(parallel ? static_cast<int>(global::numThreads) : 1);
+#endif // LIBRAPID_BLAS_OPENBLAS
+		}
+
+		/// Select a GEMM implementation for the given types and sizes, and call it. The BLAS
+		/// library's threading must already have been configured with setBlasThreads.
+		/// \see linalg::gemm
+		/// \param parallel If true, LibRapid's implementations use global::numThreads threads
+		template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C,
+				 typename Epilogue>
+		void gemmDispatch(bool transA, bool transB, Int m, Int n, Int k, const Alpha &alpha,
+						  const A *a, Int lda, const B *b, Int ldb, const Beta &beta, C *c, Int ldc,
+						  bool parallel, const Epilogue &epilogue) {
+			using BlasType = std::decay_t<decltype(*blasPointer(c))>;
+			using Index	   = BlasIndex;
+
+			constexpr bool nativeType = (std::is_same_v<C, float> || std::is_same_v<C, double>) &&
+										std::is_same_v<A, C> && std::is_same_v<B, C>;
+
+			if constexpr (nativeType) {
+				if (isSmallGemm(m, n, k)) {
+					smallGemm(transA,
+							  transB,
+							  static_cast<int64_t>(m),
+							  static_cast<int64_t>(n),
+							  static_cast<int64_t>(k),
+							  static_cast<C>(alpha),
+							  a,
+							  static_cast<int64_t>(lda),
+							  b,
+							  static_cast<int64_t>(ldb),
+							  static_cast<C>(beta),
+							  c,
+							  static_cast<int64_t>(ldc),
+							  epilogue);
+					return;
+				}
+			}
+
+			const cxxblas::Transpose opA = transA ? cxxblas::Trans : cxxblas::NoTrans;
+			const cxxblas::Transpose opB = transB ? cxxblas::Trans : cxxblas::NoTrans;
+
+			// Complex types are passed to cxxblas as std::complex, which its generic routines
+			// also support
+			const auto alpha_ = blasScalar(alpha);
+			const auto beta_  = blasScalar(beta);
+			const auto *a_	  = blasPointer(a);
+			const auto *b_	  = blasPointer(b);
+			auto *c_		  = blasPointer(c);
+
+#if defined(HAVE_CBLAS)
+			if constexpr (isBlasType<BlasType>) {
+				cxxblas::gemm(cxxblas::RowMajor,
+							  opA,
+							  opB,
+							  static_cast<Index>(m),
+							  static_cast<Index>(n),
+							  static_cast<Index>(k),
+							  alpha_,
+							  a_,
+							  static_cast<Index>(lda),
+							  b_,
+							  static_cast<Index>(ldb),
+							  beta_,
+							  c_,
+							  static_cast<Index>(ldc));
+				applyGemmEpilogue(c,
+								  static_cast<int64_t>(m),
+								  static_cast<int64_t>(n),
+								  static_cast<int64_t>(ldc),
+								  epilogue,
+								  parallel);
+				return;
+			}
+#endif // HAVE_CBLAS
+
+			if constexpr (nativeType) {
+				packedGemm(transA,
+						   transB,
+						   static_cast<int64_t>(m),
+						   static_cast<int64_t>(n),
+						   static_cast<int64_t>(k),
+						   static_cast<C>(alpha),
+						   a,
+						   static_cast<int64_t>(lda),
+						   b,
+						   static_cast<int64_t>(ldb),
+						   static_cast<C>(beta),
+						   c,
+						   static_cast<int64_t>(ldc),
+						   parallel,
+						   epilogue);
+				return;
+			}
+
+			// The generic implementation is single-threaded, so split the rows of C between
+			// threads, each of which multiplies a horizontal strip of op(A) by op(B) and then
+			// applies the epilogue to it
+			const int64_t strips = parallel ? std::min<int64_t>(global::numThreads, m) : 1;
+
+#pragma omp parallel for shared(strips, m, n, k, alpha_, a_, lda, b_, ldb, beta_, c_, ldc)         \
+  shared(opA, opB, transA, c, epilogue) default(none) num_threads(global::numThreads)              \
+  if (parallel)
+			for (int64_t strip = 0; strip < strips; ++strip) {
+				const int64_t begin = static_cast<int64_t>(m) * strip / strips;
+				const int64_t end	= static_cast<int64_t>(m) * (strip + 1) / strips;
+
+				cxxblas::gemm(cxxblas::RowMajor,
+							  opA,
+							  opB,
+							  static_cast<Index>(end - begin),
+							  static_cast<Index>(n),
+							  static_cast<Index>(k),
+							  alpha_,
+							  transA ? a_ + begin : a_ + begin * lda,
+							  static_cast<Index>(lda),
+							  b_,
+							  static_cast<Index>(ldb),
+							  beta_,
+							  c_ + begin * ldc,
+							  static_cast<Index>(ldc));
+				epilogue(c + begin * ldc, end - begin, static_cast<int64_t>(n), ldc);
+			}
+		}
+	} // namespace detail
+
+	namespace linalg {
+		/// General matrix-matrix multiplication of row-major matrices,
+		/// C = alpha * op(A) * op(B) + beta * C, where op(X) is X or its transpose. Small float
+		/// and double matrices are multiplied directly (see detail::smallGemm). Otherwise,
+		/// floating point and complex types are multiplied by the BLAS library LibRapid was built
+		/// with (through cxxblas). Without one, float and double use LibRapid's packed-panel
+		/// implementation (see detail::packedGemm), and other types cxxblas' generic one. Large
+		/// multiplications (see global::gemmMultithreadThreshold) use global::numThreads threads.
+		///
+		/// An optional epilogue (see detail::GemmNoEpilogue) is applied to each tile of C once it
+		/// is complete, allowing element-wise operations on the result to be fused into the
+		/// multiplication.
+		/// \tparam Int The index type
+		/// \tparam Alpha The type of alpha
+		/// \tparam A The scalar type of A
+		/// \tparam B The scalar type of B
+		/// \tparam Beta The type of beta
+		/// \tparam C The scalar type of C
+		/// \tparam Epilogue The epilogue type
+		/// \param transA If true, op(A) is the transpose of A
+		/// \param transB If true, op(B) is the transpose of B
+		/// \param m Rows of op(A) and C
+		/// \param n Columns of op(B) and C
+		/// \param k Columns of op(A) and rows of op(B)
+		/// \param alpha Scale factor for op(A) * op(B)
+		/// \param a The matrix A
+		/// \param lda The distance between consecutive rows of A
+		/// \param b The matrix B
+		/// \param ldb The distance between consecutive rows of B
+		/// \param beta Scale factor for C
+		/// \param c The matrix C
+		/// \param ldc The distance between consecutive rows of C
+		/// \param epilogue Called on each tile of C once it is complete
+		template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C,
+				 typename Epilogue = ::librapid::detail::GemmNoEpilogue>
+		void gemm(bool transA, bool transB, Int m, Int n, Int k, const Alpha &alpha, const A *a,
+				  Int lda, const B *b, Int ldb, const Beta &beta, C *c, Int ldc,
+				  const Epilogue &epilogue = Epilogue()) {
+			const bool parallel = ::librapid::detail::gemmShouldParallelise(m, n);
+			::librapid::detail::setBlasThreads(parallel);
+			::librapid::detail::gemmDispatch(
+			  transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc, parallel, epilogue);
+		}
+
+		/// Multiply a batch of matrices with the same dimensions, such that
+		/// c[i] = alpha * op(a[i]) * op(b[i]) + beta * c[i]. If the matrices are large enough to
+		/// be multiplied in parallel (see global::gemmMultithreadThreshold), they are multiplied
+		/// one after another. Otherwise, if the batch contains more than
+		/// global::multithreadThreshold elements of C, the matrices are distributed between
+		/// global::numThreads threads.
+		/// \see gemm
+		/// \param a Pointers to each matrix A
+		/// \param b Pointers to each matrix B
+		/// \param c Pointers to each matrix C
+		/// \param batch The number of matrices to multiply
+		/// \param epilogue Called on each tile of each matrix C once it is complete
+		template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C,
+				 typename Epilogue = ::librapid::detail::GemmNoEpilogue>
+		void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, const Alpha &alpha,
+						 const A *const *a, Int lda, const B *const *b, Int ldb, const Beta &beta,
+						 C *const *c, Int ldc, int64_t batch,
+						 const Epilogue &epilogue = Epilogue()) {
+			const bool parallelMatrix = ::librapid::detail::gemmShouldParallelise(m, n);
+			const bool parallelBatch  = !parallelMatrix && global::numThreads > 1 && batch > 1 &&
+									   batch * static_cast<int64_t>(m) * static_cast<int64_t>(n) >
+										 global::multithreadThreshold;
+
+			::librapid::detail::setBlasThreads(parallelMatrix);
+
+#pragma omp parallel for shared(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc)      \
+  shared(batch, parallelMatrix, epilogue) default(none) num_threads(global::numThreads)            \
+  if (parallelBatch)
+			for (int64_t i = 0; i < batch; ++i) {
+				::librapid::detail::gemmDispatch(transA,
+												 transB,
+												 m,
+												 n,
+												 k,
+												 alpha,
+												 a[i],
+												 lda,
+												 b[i],
+												 ldb,
+												 beta,
+												 c[i],
+												 ldc,
+												 parallelMatrix,
+												 epilogue);
+			}
+		}
+	} // namespace linalg
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_HPP
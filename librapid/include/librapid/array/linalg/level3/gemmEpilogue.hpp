@@ -0,0 +1,55 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_EPILOGUE_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_EPILOGUE_HPP
+
+namespace librapid {
+	namespace detail {
+		/// An epilogue is called by the GEMM implementations on each tile of C once its final
+		/// value has been written, as epilogue(tile, rows, cols, ldc), where tile points to the
+		/// first element of the tile and ldc is the distance between its rows. It allows
+		/// element-wise operations on the result to be applied while the tile is still in cache.
+		/// Tiles are disjoint, so an epilogue may be called from several threads at once.
+		///
+		/// This is the default epilogue, which does nothing.
+		struct GemmNoEpilogue {
+			template<typename Scalar>
+			LIBRAPID_ALWAYS_INLINE void operator()(Scalar *, int64_t, int64_t, int64_t) const {}
+		};
+
+		/// Evaluates as true if \p Epilogue does something (it is not GemmNoEpilogue)
+		/// \tparam Epilogue The epilogue type
+		template<typename Epilogue>
+		constexpr bool hasGemmEpilogue = !std::is_same_v<Epilogue, GemmNoEpilogue>;
+
+		/// Apply an epilogue to an m x n matrix in blocks of rows, which may be split between
+		/// threads. This is used after GEMM implementations which cannot call the epilogue
+		/// themselves (such as external BLAS libraries).
+		/// \tparam Scalar The scalar type
+		/// \tparam Epilogue The epilogue type
+		/// \param c The matrix C
+		/// \param m Rows of C
+		/// \param n Columns of C
+		/// \param ldc The distance between consecutive rows of C
+		/// \param epilogue The epilogue to apply
+		/// \param parallel If true, the rows are split between global::numThreads threads
+		template<typename Scalar, typename Epilogue>
+		LIBRAPID_ALWAYS_INLINE void applyGemmEpilogue(Scalar *c, int64_t m, int64_t n,
+													  int64_t ldc, const Epilogue &epilogue,
+													  bool parallel) {
+			if constexpr (hasGemmEpilogue<Epilogue>) {
+				// Blocks of rows small enough to stay in the L2 cache
+				const int64_t rowBytes	= std::max<int64_t>(n * sizeof(Scalar), 1);
+				const int64_t blockRows = std::max<int64_t>(global::l2CacheSize / rowBytes / 2, 1);
+				const int64_t blocks	= (m + blockRows - 1) / blockRows;
+
+#pragma omp parallel for shared(c, m, n, ldc, epilogue, blockRows, blocks) default(none)           \
+  num_threads(global::numThreads) if (parallel)
+				for (int64_t block = 0; block < blocks; ++block) {
+					const int64_t row = block * blockRows;
+					epilogue(c + row * ldc, std::min(blockRows, m - row), n, ldc);
+				}
+			}
+		}
+	} // namespace detail
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_EPILOGUE_HPP
@@ -0,0 +1,307 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_PACKED_GEMM_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_PACKED_GEMM_HPP
+
+namespace librapid {
+	namespace detail {
+		/// The dimensions of the blocks used by packedGemm. A kc x nr micro-panel of B stays in
+		/// the L1 cache, an mc x kc block of A stays in the L2 cache, and a kc x nc block of B
+		/// stays in the L3 cache while it is reused for every block of A.
+		struct GemmBlocking {
+			int64_t mc; // Rows of A packed at once
+			int64_t nc; // Columns of B packed at once
+			int64_t kc; // Depth of each packed block
+		};
+
+		/// Register blocking of the packedGemm micro-kernel. Each call computes an mr x nr tile of
+		/// C, held in mr * nr / packetWidth Packet accumulators. Six rows of two packets use 12
+		/// registers for the accumulators, leaving enough for the operands on all common targets.
+		/// \tparam Scalar The scalar type
+		template<typename Scalar>
+		struct GemmKernelShape {
+			static constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			static constexpr int64_t mr			 = 6;
+			static constexpr int64_t nrPackets	 = 2;
+			static constexpr int64_t nr			 = nrPackets * packetWidth;
+		};
+
+		/// Compute the block sizes for packedGemm from the cache sizes in global::. Each block
+		/// uses half of its cache, leaving room for the other operands and C.
+		/// \tparam Scalar The scalar type
+		/// \param m Rows of C
+		/// \param n Columns of C
+		/// \param k The depth of the multiplication
+		/// \param threads The number of threads the blocks of A are distributed between
+		/// \return The block sizes
+		template<typename Scalar>
+		LIBRAPID_NODISCARD GemmBlocking gemmBlocking(int64_t m, int64_t n, int64_t k,
+													 int64_t threads) {
+			using Kernel		   = GemmKernelShape<Scalar>;
+			constexpr int64_t mr   = Kernel::mr;
+			constexpr int64_t nr   = Kernel::nr;
+			constexpr int64_t size = sizeof(Scalar);
+
+			auto roundUp = [](int64_t val, int64_t multiple) {
+				return (val + multiple - 1) / multiple * multiple;
+			};
+
+			GemmBlocking res {};
+			res.kc = std::clamp<int64_t>(global::l1CacheSize / (2 * nr * size), 16, 1024);
+			res.kc = std::min(res.kc, k);
+
+			res.mc = global::l2CacheSize / (2 * res.kc * size);
+			res.mc = std::max(res.mc - res.mc % mr, mr);
+			// Every thread needs at least one block of A to work on
+			res.mc = std::min(res.mc, roundUp((m + threads - 1) / threads, mr));
+
+			res.nc = global::l3CacheSize / (2 * res.kc * size);
+			res.nc = std::max(res.nc - res.nc % nr, nr);
+			res.nc = std::min(res.nc, roundUp(n, nr));
+			return res;
+		}
+
+		/// Pack an mc x kc block of op(A) into micro-panels of mr rows. Within a micro-panel the
+		/// mr elements of each column are contiguous, so the micro-kernel reads the panel
+		/// sequentially. Rows past the end of A are filled with zeros.
+		/// \tparam Scalar The scalar type
+		/// \param a The first element of the block in A
+		/// \param lda The distance between consecutive rows of A
+		/// \param transA If true, op(A) is the transpose of A
+		/// \param mc Rows of the block
+		/// \param kc Columns of the block
+		/// \param packed The destination (at least roundUp(mc, mr) * kc elements)
+		template<typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void packGemmA(const Scalar *a, int64_t lda, bool transA,
+											  int64_t mc, int64_t kc, Scalar *packed) {
+			constexpr int64_t mr = GemmKernelShape<Scalar>::mr;
+
+			for (int64_t i = 0; i < mc; i += mr) {
+				const int64_t rows = std::min(mr, mc - i);
+				for (int64_t p = 0; p < kc; ++p) {
+					for (int64_t r = 0; r < rows; ++r) {
+						packed[r] = transA ? a[p * lda + i + r] : a[(i + r) * lda + p];
+					}
+					for (int64_t r = rows; r < mr; ++r) { packed[r] = Scalar(0); }
+					packed += mr;
+				}
+			}
+		}
+
+		/// Pack a kc x nr micro-panel of op(B). The nr elements of each row are contiguous, so
+		/// the micro-kernel loads them as whole Packets. Columns past the end of B are filled
+		/// with zeros.
+		/// \tparam Scalar The scalar type
+		/// \param b The first element of the micro-panel in B
+		/// \param ldb The distance between consecutive rows of B
+		/// \param transB If true, op(B) is the transpose of B
+		/// \param kc Rows of the micro-panel
+		/// \param cols Columns of the micro-panel which are inside B
+		/// \param packed The destination (kc * nr elements)
+		template<typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void packGemmB(const Scalar *b, int64_t ldb, bool transB,
+											  int64_t kc, int64_t cols, Scalar *packed) {
+			constexpr int64_t nr = GemmKernelShape<Scalar>::nr;
+
+			for (int64_t p = 0; p < kc; ++p) {
+				if (!transB && cols == nr) {
+					std::copy(b + p * ldb, b + p * ldb + nr, packed);
+				} else {
+					for (int64_t c = 0; c < cols; ++c) {
+						packed[c] = transB ? b[c * ldb + p] : b[p * ldb + c];
+					}
+					for (int64_t c = cols; c < nr; ++c) { packed[c] = Scalar(0); }
+				}
+				packed += nr;
+			}
+		}
+
+		/// Compute an mr x nr tile, C = alpha * A * B + beta * C, from packed micro-panels of A
+		/// and B. The tile is accumulated in registers and written to C once. Tiles on the edges
+		/// of C are accumulated in full and only the valid rows and columns are written.
+		/// \tparam Scalar The scalar type
+		/// \param kc The depth of the micro-panels
+		/// \param a The packed micro-panel of A
+		/// \param b The packed micro-panel of B
+		/// \param alpha Scale factor for A * B
+		/// \param beta Scale factor for C (C is not read if this is zero)
+		/// \param c The first element of the tile in C
+		/// \param ldc The distance between consecutive rows of C
+		/// \param rows Rows of the tile which are inside C
+		/// \param cols Columns of the tile which are inside C
+		template<typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void gemmMicroKernel(int64_t kc, const Scalar *a, const Scalar *b,
+													Scalar alpha, Scalar beta, Scalar *c,
+													int64_t ldc, int64_t rows, int64_t cols) {
+			using Packet				= typename typetraits::TypeInfo<Scalar>::Packet;
+			using Kernel				= GemmKernelShape<Scalar>;
+			constexpr int64_t mr		= Kernel::mr;
+			constexpr int64_t nr		= Kernel::nr;
+			constexpr int64_t nrPackets = Kernel::nrPackets;
+			constexpr int64_t width		= Kernel::packetWidth;
+
+			Packet acc[mr][nrPackets];
+			for (int64_t r = 0; r < mr; ++r) {
+				for (int64_t j = 0; j < nrPackets; ++j) { acc[r][j] = Packet(Scalar(0)); }
+			}
+
+			for (int64_t p = 0; p < kc; ++p) {
+				Packet bRow[nrPackets];
+				for (int64_t j = 0; j < nrPackets; ++j) { bRow[j].load(b + j * width); }
+
+				for (int64_t r = 0; r < mr; ++r) {
+					const Packet aVal(a[r]);
+					for (int64_t j = 0; j < nrPackets; ++j) { acc[r][j] += aVal * bRow[j]; }
+				}
+
+				a += mr;
+				b += nr;
+			}
+
+			const Packet alphaPacket(alpha);
+			const Packet betaPacket(beta);
+
+			if (rows == mr && cols == nr) {
+				for (int64_t r = 0; r < mr; ++r) {
+					for (int64_t j = 0; j < nrPackets; ++j) {
+						Scalar *dst = c + r * ldc + j * width;
+						Packet res	= acc[r][j] * alphaPacket;
+						if (beta != Scalar(0)) {
+							Packet prev;
+							prev.load(dst);
+							res += prev * betaPacket;
+						}
+						res.store(dst);
+					}
+				}
+				return;
+			}
+
+			Scalar tile[mr * nr];
+			for (int64_t r = 0; r < mr; ++r) {
+				for (int64_t j = 0; j < nrPackets; ++j) {
+					(acc[r][j] * alphaPacket).store(tile + r * nr + j * width);
+				}
+			}
+
+			for (int64_t r = 0; r < rows; ++r) {
+				for (int64_t col = 0; col < cols; ++col) {
+					Scalar &dst = c[r * ldc + col];
+					dst = beta == Scalar(0) ? tile[r * nr + col] : tile[r * nr + col] + beta * dst;
+				}
+			}
+		}
+
+		/// Packed-panel matrix multiplication of row-major matrices,
+		/// C = alpha * op(A) * op(B) + beta * C. The matrices are split into cache-sized blocks
+		/// (see gemmBlocking), which are copied into contiguous micro-panels and multiplied by a
+		/// register-blocked micro-kernel (see gemmMicroKernel). When running in parallel, each
+		/// block of B is packed cooperatively and the blocks of A are distributed between the
+		/// threads. The epilogue is called on each micro-tile of C as soon as it is complete.
+		/// \tparam Scalar The scalar type (float or double)
+		/// \tparam Epilogue The epilogue type (see GemmNoEpilogue)
+		/// \param transA If true, op(A) is the transpose of A
+		/// \param transB If true, op(B) is the transpose of B
+		/// \param m Rows of op(A) and C
+		/// \param n Columns of op(B) and C
+		/// \param k Columns of op(A) and rows of op(B)
+		/// \param alpha Scale factor for op(A) * op(B)
+		/// \param a The matrix A
+		/// \param lda The distance between consecutive rows of A
+		/// \param b The matrix B
+		/// \param ldb The distance between consecutive rows of B
+		/// \param beta Scale factor for C (C is not read if this is zero)
+		/// \param c The matrix C
+		/// \param ldc The distance between consecutive rows of C
+		/// \param parallel If true, the multiplication uses global::numThreads threads
+		/// \param epilogue Called on each tile of C once it is complete
+		template<typename Scalar, typename Epilogue = GemmNoEpilogue>
+		void packedGemm(bool transA, bool transB, int64_t m, int64_t n, int64_t k, Scalar alpha,
+						const Scalar *a, int64_t lda, const Scalar *b, int64_t ldb, Scalar beta,
+						Scalar *c, int64_t ldc, bool parallel,
+						const Epilogue &epilogue = Epilogue()) {
+			// Referenced as members so they need not be shared with the OpenMP threads
+			using Kernel = GemmKernelShape<Scalar>;
+
+			if (m <= 0 || n <= 0) return;
+
+			if (k <= 0) {
+				for (int64_t i = 0; i < m; ++i) {
+					for (int64_t j = 0; j < n; ++j) {
+						Scalar &dst = c[i * ldc + j];
+						dst			= beta == Scalar(0) ? Scalar(0) : beta * dst;
+					}
+				}
+				applyGemmEpilogue(c, m, n, ldc, epilogue, parallel);
+				return;
+			}
+
+			const int64_t threads		= parallel ? global::numThreads : 1;
+			const GemmBlocking blocking = gemmBlocking<Scalar>(m, n, k, threads);
+			const int64_t mc			= blocking.mc;
+			const int64_t nc			= blocking.nc;
+			const int64_t kc			= blocking.kc;
+			const int64_t mBlocks		= (m + mc - 1) / mc;
+
+			std::vector<Scalar> packedB(nc * kc);
+			Scalar *packedBData = packedB.data();
+
+#pragma omp parallel shared(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc)         \
+  shared(mc, nc, kc, mBlocks, packedBData, epilogue) default(none) num_threads(threads)           \
+  if (parallel)
+			{
+				std::vector<Scalar> packedA(mc * kc);
+
+				for (int64_t jc = 0; jc < n; jc += nc) {
+					const int64_t ncCur = std::min(nc, n - jc);
+					const int64_t panels = (ncCur + Kernel::nr - 1) / Kernel::nr;
+
+					for (int64_t pc = 0; pc < k; pc += kc) {
+						const int64_t kcCur = std::min(kc, k - pc);
+						// Later blocks of k accumulate into the result of the first
+						const Scalar betaCur = pc == 0 ? beta : Scalar(1);
+						const bool lastBlock = pc + kcCur == k;
+
+#pragma omp for
+						for (int64_t jr = 0; jr < panels; ++jr) {
+							const int64_t col  = jc + jr * Kernel::nr;
+							const Scalar *bSrc = transB ? b + col * ldb + pc : b + pc * ldb + col;
+							packGemmB(bSrc,
+									  ldb,
+									  transB,
+									  kcCur,
+									  std::min(Kernel::nr, n - col),
+									  packedBData + jr * Kernel::nr * kcCur);
+						}
+
+#pragma omp for
+						for (int64_t block = 0; block < mBlocks; ++block) {
+							const int64_t ic	= block * mc;
+							const int64_t mcCur = std::min(mc, m - ic);
+							const Scalar *aSrc	= transA ? a + pc * lda + ic : a + ic * lda + pc;
+							packGemmA(aSrc, lda, transA, mcCur, kcCur, packedA.data());
+
+							for (int64_t jr = 0; jr < panels; ++jr) {
+								const int64_t cols = std::min(Kernel::nr, ncCur - jr * Kernel::nr);
+								for (int64_t ir = 0; ir < mcCur; ir += Kernel::mr) {
+									Scalar *tile = c + (ic + ir) * ldc + jc + jr * Kernel::nr;
+									const int64_t rows = std::min(Kernel::mr, mcCur - ir);
+									gemmMicroKernel(kcCur,
+													packedA.data() + ir * kcCur,
+													packedBData + jr * Kernel::nr * kcCur,
+													alpha,
+													betaCur,
+													tile,
+													ldc,
+													rows,
+													cols);
+									if (lastBlock) epilogue(tile, rows, cols, ldc);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	} // namespace detail
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_PACKED_GEMM_HPP
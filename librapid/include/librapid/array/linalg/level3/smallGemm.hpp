@@ -0,0 +1,108 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_SMALL_GEMM_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_SMALL_GEMM_HPP
+
+namespace librapid {
+	namespace detail {
+		/// Matrices with no dimension larger than this are multiplied by smallGemm. At these
+		/// sizes, the operands fit in the L1 cache, so packing them (or calling into a BLAS
+		/// library) costs more than it saves.
+		constexpr int64_t smallGemmMaxSize = 32;
+
+		/// Returns true if a multiplication is small enough for smallGemm
+		/// \param m Rows of C
+		/// \param n Columns of C
+		/// \param k The depth of the multiplication
+		/// \return True if smallGemm should be used
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isSmallGemm(int64_t m, int64_t n,
+																   int64_t k) {
+			return m <= smallGemmMaxSize && n <= smallGemmMaxSize && k <= smallGemmMaxSize;
+		}
+
+		/// Matrix multiplication of small row-major matrices, C = alpha * op(A) * op(B) + beta * C,
+		/// reading the operands in place. Each row of C is accumulated in Packets by
+		/// broadcasting the elements of a row of op(A) across contiguous rows of B. If B is
+		/// transposed, its columns are contiguous instead, so each element of C is computed as a
+		/// vectorised dot product. The operands fit in cache, so the epilogue is called once, on
+		/// the whole of C.
+		/// \tparam Scalar The scalar type (float or double)
+		/// \tparam Epilogue The epilogue type (see GemmNoEpilogue)
+		/// \param transA If true, op(A) is the transpose of A
+		/// \param transB If true, op(B) is the transpose of B
+		/// \param m Rows of op(A) and C
+		/// \param n Columns of op(B) and C
+		/// \param k Columns of op(A) and rows of op(B)
+		/// \param alpha Scale factor for op(A) * op(B)
+		/// \param a The matrix A
+		/// \param lda The distance between consecutive rows of A
+		/// \param b The matrix B
+		/// \param ldb The distance between consecutive rows of B
+		/// \param beta Scale factor for C (C is not read if this is zero)
+		/// \param c The matrix C
+		/// \param ldc The distance between consecutive rows of C
+		/// \param epilogue Called on C once it is complete
+		template<typename Scalar, typename Epilogue = GemmNoEpilogue>
+		void smallGemm(bool transA, bool transB, int64_t m, int64_t n, int64_t k, Scalar alpha,
+					   const Scalar *a, int64_t lda, const Scalar *b, int64_t ldb, Scalar beta,
+					   Scalar *c, int64_t ldc, const Epilogue &epilogue = Epilogue()) {
+			using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+			auto update = [alpha, beta](Scalar &dst, Scalar val) {
+				dst = beta == Scalar(0) ? alpha * val : alpha * val + beta * dst;
+			};
+
+			for (int64_t i = 0; i < m; ++i) {
+				const Scalar *aRow = transA ? a + i : a + i * lda;
+				const int64_t aInc = transA ? lda : 1;
+				Scalar *cRow	   = c + i * ldc;
+
+				if (transB) {
+					for (int64_t j = 0; j < n; ++j) {
+						const Scalar *bCol = b + j * ldb;
+						Scalar sum(0);
+						int64_t p = 0;
+						if (!transA) {
+							Packet acc(Scalar(0));
+							for (; p + packetWidth <= k; p += packetWidth) {
+								Packet aVals, bVals;
+								aVals.load(aRow + p);
+								bVals.load(bCol + p);
+								acc += aVals * bVals;
+							}
+							sum = acc.sum();
+						}
+						for (; p < k; ++p) { sum += aRow[p * aInc] * bCol[p]; }
+						update(cRow[j], sum);
+					}
+					continue;
+				}
+
+				int64_t j = 0;
+				for (; j + packetWidth <= n; j += packetWidth) {
+					Packet acc(Scalar(0));
+					for (int64_t p = 0; p < k; ++p) {
+						Packet bVals;
+						bVals.load(b + p * ldb + j);
+						acc += Packet(aRow[p * aInc]) * bVals;
+					}
+
+					Scalar res[packetWidth];
+					acc.store(res);
+					for (int64_t col = 0; col < packetWidth; ++col) {
+						update(cRow[j + col], res[col]);
+					}
+				}
+
+				for (; j < n; ++j) {
+					Scalar sum(0);
+					for (int64_t p = 0; p < k; ++p) { sum += aRow[p * aInc] * b[p * ldb + j]; }
+					update(cRow[j], sum);
+				}
+			}
+
+			epilogue(c, m, n, ldc);
+		}
+	} // namespace detail
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_SMALL_GEMM_HPP
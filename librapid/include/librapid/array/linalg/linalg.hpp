@@ -0,0 +1,10 @@
+#ifndef LIBRAPID_ARRAY_LINALG
+#define LIBRAPID_ARRAY_LINALG
+
+#include "level3/gemmEpilogue.hpp"
+#include "level3/smallGemm.hpp"
+#include "level3/packedGemm.hpp"
+#include "level3/gemm.hpp"
+#include "arrayMultiply.hpp"
+
+#endif // LIBRAPID_ARRAY_LINALG
@@ -0,0 +1,49 @@
+#ifndef LIBRAPID_ARRAY_MAPPED_ARRAY_HPP
+#define LIBRAPID_ARRAY_MAPPED_ARRAY_HPP
+
+namespace librapid {
+	/// Create an array which is backed directly by a file, without reading it into memory. The
+	/// array can be used in expressions like any other, and with MmapMode::ReadWrite, changes
+	/// are written back to the file (which is created or extended to fit the array).
+	/// \tparam Scalar The type of the elements
+	/// \param path The path of the file
+	/// \param shape The shape of the array
+	/// \param mode How the file is mapped
+	/// \param advice The access pattern hint for the mapping
+	/// \param offset The offset (in bytes) within the file of the first element, which must be a
+	/// multiple of alignof(Scalar)
+	/// \return The file-backed array
+	template<typename Scalar>
+	LIBRAPID_NODISCARD Array<Scalar, MmapStorage<Scalar>>
+	mapArray(const std::string &path,
+			 const typename Array<Scalar, MmapStorage<Scalar>>::ShapeType &shape,
+			 MmapMode mode = MmapMode::ReadOnly, MmapAdvice advice = MmapAdvice::Normal,
+			 size_t offset = 0) {
+		MmapAllocator<Scalar> allocator(path, mode, advice, offset);
+		return Array<Scalar, MmapStorage<Scalar>>(shape,
+												  MmapStorage<Scalar>(shape.size(), allocator));
+	}
+
+	/// Create a one-dimensional array which is backed directly by a file, and covers all of the
+	/// file after \p offset
+	/// \tparam Scalar The type of the elements
+	/// \param path The path of the file
+	/// \param mode How the file is mapped
+	/// \param advice The access pattern hint for the mapping
+	/// \param offset The offset (in bytes) within the file of the first element, which must be a
+	/// multiple of alignof(Scalar)
+	/// \return The file-backed array
+	/// \see mapArray(const std::string &, const ShapeType &, MmapMode, MmapAdvice, size_t)
+	template<typename Scalar>
+	LIBRAPID_NODISCARD Array<Scalar, MmapStorage<Scalar>>
+	mapArray(const std::string &path, MmapMode mode = MmapMode::ReadOnly,
+			 MmapAdvice advice = MmapAdvice::Normal, size_t offset = 0) {
+		using ShapeType = typename Array<Scalar, MmapStorage<Scalar>>::ShapeType;
+		MmapAllocator<Scalar> allocator(path, mode, advice, offset);
+		const size_t elements = allocator.fileElements();
+		return Array<Scalar, MmapStorage<Scalar>>(ShapeType({elements}),
+												  MmapStorage<Scalar>(elements, allocator));
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_MAPPED_ARRAY_HPP
@@ -34,6 +34,38 @@
 		}                                                                                          \
 	}
 
+#define LIBRAPID_UNARY_FUNCTOR(NAME_, OP_)                                                         \
+	struct NAME_ {                                                                                 \
+		template<typename T>                                                                       \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &val) const {            \
+			return ::librapid::OP_(val);                                                           \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &val) const {           \
+			if constexpr (std::is_floating_point_v<typename Packet::EntryType>) {                  \
+				return Vc::OP_(val);                                                               \
+			} else {                                                                               \
+				return ::librapid::detail::packetLanewise(                                         \
+				  val, [](const auto &x) { return ::librapid::OP_(x); });                          \
+			}                                                                                      \
+		}                                                                                          \
+	}
+
+#define LIBRAPID_UNARY_FUNCTOR_LANEWISE(NAME_, OP_)                                                \
+	struct NAME_ {                                                                                 \
+		template<typename T>                                                                       \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &val) const {            \
+			return ::librapid::OP_(val);                                                           \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &val) const {           \
+			return ::librapid::detail::packetLanewise(                                             \
+			  val, [](const auto &x) { return ::librapid::OP_(x); });                              \
+		}                                                                                          \
+	}
+
 #define LIBRAPID_BINARY_KERNEL_GETTER                                                              \
 	template<typename T1, typename T2>                                                             \
 	static constexpr const char *getKernelNameImpl(std::tuple<T1, T2> args) {                      \
@@ -61,9 +93,7 @@
 	  const std::tuple<First, Second> &tup) {                                                      \
 		if constexpr (TypeInfo<std::decay_t<First>>::type != detail::LibRapidType::Scalar &&       \
 					  TypeInfo<std::decay_t<Second>>::type != detail::LibRapidType::Scalar) {      \
-			LIBRAPID_ASSERT(std::get<0>(tup).shape() == std::get<1>(tup).shape(),                  \
-							"Shapes must match for binary operations");                            \
-			return std::get<0>(tup).shape();                                                       \
+			return broadcastShape(std::get<0>(tup).shape(), std::get<1>(tup).shape());             \
 		} else if constexpr (TypeInfo<std::decay_t<First>>::type ==                                \
 							 detail::LibRapidType::Scalar) {                                       \
 			return std::get<1>(tup).shape();                                                       \
@@ -79,18 +109,46 @@
 		return getShapeImpl(args);                                                                 \
 	}
 
+#define LIBRAPID_UNARY_KERNEL_GETTER                                                               \
+	template<typename... Args>                                                                     \
+	static constexpr const char *getKernelName(std::tuple<Args...> args) {                         \
+		static_assert(sizeof...(Args) == 1, "Invalid number of arguments for unary operation");    \
+		return kernelName;                                                                         \
+	}
+
+#define LIBRAPID_UNARY_SHAPE_EXTRACTOR                                                             \
+	template<typename... Args>                                                                     \
+	LIBRAPID_NODISCARD static LIBRAPID_ALWAYS_INLINE auto getShape(                                \
+	  const std::tuple<Args...> &args) {                                                           \
+		static_assert(sizeof...(Args) == 1, "Invalid number of arguments for unary operation");    \
+		return std::get<0>(args).shape();                                                          \
+	}
+
+#define LIBRAPID_TERNARY_SHAPE_EXTRACTOR                                                           \
+	template<typename... Args>                                                                     \
+	LIBRAPID_NODISCARD static LIBRAPID_ALWAYS_INLINE auto getShape(                                \
+	  const std::tuple<Args...> &args) {                                                           \
+		static_assert(sizeof...(Args) == 3, "Invalid number of arguments for ternary operation");  \
+		return std::apply(                                                                         \
+		  [](const auto &...vals) { return detail::broadcastArgumentShapes(vals...); }, args);     \
+	}
+
 namespace librapid {
 	namespace detail {
-		/// Construct a new function object with the given functor type and arguments.
-		/// \tparam desc Functor descriptor
-		/// \tparam Functor Function type
-		/// \tparam Args Argument types
-		/// \param args Arguments passed to the function (forwarded)
-		/// \return A new Function instance
-		template<typename desc, typename Functor, typename... Args>
-		auto makeFunction(Args &&...args) {
-			using OperationType = Function<desc, Functor, Args...>;
-			return OperationType(Functor(), std::forward<Args>(args)...);
+		/// Apply a scalar operation to each lane of a packet in turn. This is used for operations
+		/// which have no SIMD implementation, allowing them to remain part of a vectorised
+		/// expression without forcing the whole expression onto the scalar path.
+		/// \tparam Packet The packet type
+		/// \tparam Op The scalar operation type
+		/// \param val The packet to operate on
+		/// \param op The operation to apply to each lane
+		/// \return A new packet containing the result of the operation
+		template<typename Packet, typename Op>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetLanewise(const Packet &val,
+																		Op &&op) {
+			Packet res;
+			for (size_t i = 0; i < Packet::size(); ++i) res[i] = op(val[i]);
+			return res;
 		}
 
 		LIBRAPID_BINARY_FUNCTOR(Plus, +);	  // a + b
@@ -104,21 +162,253 @@ namespace librapid {
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(GreaterThanEqual, >=);	 // a >= b
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseEqual, ==);	 // a == b
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseNotEqual, !=); // a != b
-	}																 // namespace detail
+
+		LIBRAPID_UNARY_FUNCTOR(Sin, sin);	  // sin(a)
+		LIBRAPID_UNARY_FUNCTOR(Cos, cos);	  // cos(a)
+		LIBRAPID_UNARY_FUNCTOR(Asin, asin);	  // asin(a)
+		LIBRAPID_UNARY_FUNCTOR(Atan, atan);	  // atan(a)
+		LIBRAPID_UNARY_FUNCTOR(Exp, exp);	  // exp(a)
+		LIBRAPID_UNARY_FUNCTOR(Log, log);	  // log(a)
+		LIBRAPID_UNARY_FUNCTOR(Log2, log2);	  // log2(a)
+		LIBRAPID_UNARY_FUNCTOR(Log10, log10); // log10(a)
+		LIBRAPID_UNARY_FUNCTOR(Sqrt, sqrt);	  // sqrt(a)
+		LIBRAPID_UNARY_FUNCTOR(Abs, abs);	  // abs(a)
+		LIBRAPID_UNARY_FUNCTOR(Floor, floor); // floor(a)
+		LIBRAPID_UNARY_FUNCTOR(Ceil, ceil);	  // ceil(a)
+
+		// Vc does not provide SIMD implementations of these, so they are evaluated lane by lane
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Tan, tan);	   // tan(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Acos, acos);   // acos(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Sinh, sinh);   // sinh(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Cosh, cosh);   // cosh(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Tanh, tanh);   // tanh(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Asinh, asinh); // asinh(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Acosh, acosh); // acosh(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Atanh, atanh); // atanh(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Exp2, exp2);   // exp2(a)
+		LIBRAPID_UNARY_FUNCTOR_LANEWISE(Cbrt, cbrt);   // cbrt(a)
+
+		/// Compute a * b + c with a single rounding where the type supports it
+		/// \tparam A The type of the first multiplicand
+		/// \tparam B The type of the second multiplicand
+		/// \tparam C The type of the addend
+		/// \param a The first multiplicand
+		/// \param b The second multiplicand
+		/// \param c The addend
+		/// \return a * b + c
+		template<typename A, typename B, typename C>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto scalarFma(const A &a, const B &b,
+																 const C &c) {
+			if constexpr (std::is_floating_point_v<A> && std::is_same_v<A, B> &&
+						  std::is_same_v<A, C>) {
+				return std::fma(a, b, c);
+			} else {
+				return a * b + c;
+			}
+		}
+
+		/// Compute a * b + c for packets, using a fused multiply-add instruction for floating
+		/// point types
+		/// \tparam Packet The packet type
+		/// \param a The first multiplicand
+		/// \param b The second multiplicand
+		/// \param c The addend
+		/// \return a * b + c
+		template<typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetFma(const Packet &a, const Packet &b,
+																   const Packet &c) {
+			if constexpr (std::is_floating_point_v<typename Packet::EntryType>) {
+				return Vc::fma(a, b, c);
+			} else {
+				return a * b + c;
+			}
+		}
+
+		// Fused operations. These are never created directly -- makeFunction produces them when
+		// it recognises a multiplication feeding into an addition or subtraction
+
+		struct MultiplyAdd { // a * b + c
+			template<typename A, typename B, typename C>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const A &a, const B &b,
+																	  const C &c) const {
+				return scalarFma(a, b, c);
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+			packet(const Packet &a, const Packet &b, const Packet &c) const {
+				return packetFma(a, b, c);
+			}
+		};
+
+		struct MultiplySubtract { // a * b - c
+			template<typename A, typename B, typename C>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const A &a, const B &b,
+																	  const C &c) const {
+				return scalarFma(a, b, -c);
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+			packet(const Packet &a, const Packet &b, const Packet &c) const {
+				return packetFma(a, b, Packet(-c));
+			}
+		};
+
+		struct NegativeMultiplyAdd { // c - a * b
+			template<typename A, typename B, typename C>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const A &a, const B &b,
+																	  const C &c) const {
+				return scalarFma(-a, b, c);
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+			packet(const Packet &a, const Packet &b, const Packet &c) const {
+				return packetFma(Packet(-a), b, c);
+			}
+		};
+
+		/// Evaluates as true if the input type is a (trivial) element-wise multiplication, in
+		/// which case the argument types are also exposed
+		/// \tparam T The type to check
+		template<typename T>
+		struct IsMultiplyFunction : std::false_type {};
+
+		template<typename A, typename B>
+		struct IsMultiplyFunction<Function<descriptor::Trivial, Multiply, A, B>> : std::true_type {
+			using Lhs = A;
+			using Rhs = B;
+		};
+
+		/// Evaluates as true if a Function with the given descriptor, functor and arguments can
+		/// be contracted into a fused multiply-add operation. This is only done on the CPU, since
+		/// the CUDA backend evaluates each node with a dedicated kernel
+		/// \tparam desc The descriptor of the Function
+		/// \tparam Functor The functor of the Function
+		/// \tparam Args The argument types of the Function
+		template<typename desc, typename Functor, typename... Args>
+		struct CanFuseMultiplyAdd : std::false_type {};
+
+		template<typename desc, typename Functor, typename LHS, typename RHS>
+		struct CanFuseMultiplyAdd<desc, Functor, LHS, RHS> {
+			using Device = typename typetraits::TypeInfo<Function<desc, Functor, LHS, RHS>>::Device;
+
+			static constexpr bool value =
+			  std::is_same_v<desc, descriptor::Trivial> &&
+			  (std::is_same_v<Functor, Plus> || std::is_same_v<Functor, Minus>) &&
+			  std::is_same_v<Device, device::CPU> &&
+			  (IsMultiplyFunction<std::decay_t<LHS>>::value ||
+			   IsMultiplyFunction<std::decay_t<RHS>>::value);
+		};
+
+		/// Extract an element of a Function's argument tuple such that it can be forwarded into
+		/// a new Function. References are passed through, while values are copied.
+		/// \tparam I The index of the element
+		/// \tparam Tuple The tuple type
+		/// \param tup The tuple
+		/// \return The element, as a reference or a new value
+		template<size_t I, typename Tuple>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE decltype(auto)
+		forwardTupleElement(const Tuple &tup) {
+			using Element = std::tuple_element_t<I, Tuple>;
+			if constexpr (std::is_lvalue_reference_v<Element>) {
+				return std::get<I>(tup);
+			} else {
+				return std::decay_t<Element>(std::get<I>(tup));
+			}
+		}
+
+		/// Contract an addition or subtraction involving a multiplication into a single fused
+		/// multiply-add Function, so a * b + c evaluates with one FMA per packet
+		/// \tparam Functor The functor of the outer operation (Plus or Minus)
+		/// \tparam LHS The type of the left-hand argument
+		/// \tparam RHS The type of the right-hand argument
+		/// \param lhs The left-hand argument
+		/// \param rhs The right-hand argument
+		/// \return The fused Function
+		template<typename Functor, typename LHS, typename RHS>
+		LIBRAPID_NODISCARD auto fuseMultiplyAdd(LHS &&lhs, RHS &&rhs) {
+			if constexpr (IsMultiplyFunction<std::decay_t<LHS>>::value) {
+				// (a * b) + c or (a * b) - c
+				using Multiply = IsMultiplyFunction<std::decay_t<LHS>>;
+				using Fused =
+				  std::conditional_t<std::is_same_v<Functor, Plus>, MultiplyAdd, MultiplySubtract>;
+				using FunctionType = Function<descriptor::Trivial, Fused, typename Multiply::Lhs,
+											  typename Multiply::Rhs, RHS>;
+				return FunctionType(Fused(),
+									forwardTupleElement<0>(lhs.args()),
+									forwardTupleElement<1>(lhs.args()),
+									std::forward<RHS>(rhs));
+			} else {
+				// c + (a * b) or c - (a * b)
+				using Multiply = IsMultiplyFunction<std::decay_t<RHS>>;
+				using Fused	   = std::conditional_t<std::is_same_v<Functor, Plus>, MultiplyAdd,
+												NegativeMultiplyAdd>;
+				using FunctionType = Function<descriptor::Trivial, Fused, typename Multiply::Lhs,
+											  typename Multiply::Rhs, LHS>;
+				return FunctionType(Fused(),
+									forwardTupleElement<0>(rhs.args()),
+									forwardTupleElement<1>(rhs.args()),
+									std::forward<LHS>(lhs));
+			}
+		}
+
+		/// Construct a new function object with the given functor type and arguments. Additions
+		/// and subtractions with a multiplication as an operand are contracted into a single
+		/// fused multiply-add operation (see fuseMultiplyAdd).
+		/// \tparam desc Functor descriptor
+		/// \tparam Functor Function type
+		/// \tparam Args Argument types
+		/// \param args Arguments passed to the function (forwarded)
+		/// \return A new Function instance
+		template<typename desc, typename Functor, typename... Args>
+		auto makeFunction(Args &&...args) {
+			if constexpr (CanFuseMultiplyAdd<desc, Functor, Args...>::value) {
+				return fuseMultiplyAdd<Functor>(std::forward<Args>(args)...);
+			} else {
+				using OperationType = Function<desc, Functor, Args...>;
+				return OperationType(Functor(), std::forward<Args>(args)...);
+			}
+		}
+
+		/// Compute the broadcast shape of a set of Function arguments, ignoring any scalars
+		/// \tparam First The type of the first argument
+		/// \tparam Rest The types of the remaining arguments
+		/// \param first The first argument
+		/// \param rest The remaining arguments
+		/// \return The shape of the result
+		template<typename First, typename... Rest>
+		LIBRAPID_NODISCARD auto broadcastArgumentShapes(const First &first, const Rest &...rest) {
+			constexpr auto scalarType = LibRapidType::Scalar;
+			if constexpr (typetraits::TypeInfo<std::decay_t<First>>::type == scalarType) {
+				return broadcastArgumentShapes(rest...);
+			} else if constexpr (((typetraits::TypeInfo<std::decay_t<Rest>>::type == scalarType) &&
+								  ...)) {
+				return Shape<size_t, 32>(first.shape());
+			} else {
+				return broadcastShape(Shape<size_t, 32>(first.shape()),
+									  broadcastArgumentShapes(rest...));
+			}
+		}
+	} // namespace detail
 
 	namespace typetraits {
 		/// Merge together two Descriptor types. Two trivial operations will result in
-		/// another trivial operation, while any other combination will result in a Combined
-		/// operation. \tparam Descriptor1 The first descriptor \tparam Descriptor2 The
-		/// second descriptor
+		/// another trivial operation, while any other combination (including an element-wise
+		/// operation on a single non-trivial one, which is merged with Trivial) will result in
+		/// a Combined operation.
+		/// \tparam Descriptor1 The first descriptor
+		/// \tparam Descriptor2 The second descriptor
 		template<typename Descriptor1, typename Descriptor2>
 		struct DescriptorMerger {
 			using Type = ::librapid::detail::descriptor::Combined;
 		};
 
-		template<typename Descriptor1>
-		struct DescriptorMerger<Descriptor1, Descriptor1> {
-			using Type = Descriptor1;
+		template<>
+		struct DescriptorMerger<::librapid::detail::descriptor::Trivial,
+								::librapid::detail::descriptor::Trivial> {
+			using Type = ::librapid::detail::descriptor::Trivial;
 		};
 
 		/// Extracts the Descriptor type of the provided type.
@@ -301,13 +591,229 @@ namespace librapid {
 			LIBRAPID_BINARY_KERNEL_GETTER
 			LIBRAPID_BINARY_SHAPE_EXTRACTOR
 		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Sin> {
+			static constexpr const char *name		= "sin";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "sinArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Cos> {
+			static constexpr const char *name		= "cos";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "cosArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Tan> {
+			static constexpr const char *name		= "tan";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "tanArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Asin> {
+			static constexpr const char *name		= "asin";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "asinArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Acos> {
+			static constexpr const char *name		= "acos";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "acosArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Atan> {
+			static constexpr const char *name		= "atan";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "atanArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Sinh> {
+			static constexpr const char *name		= "sinh";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "sinhArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Cosh> {
+			static constexpr const char *name		= "cosh";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "coshArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Tanh> {
+			static constexpr const char *name		= "tanh";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "tanhArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Asinh> {
+			static constexpr const char *name		= "asinh";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "asinhArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Acosh> {
+			static constexpr const char *name		= "acosh";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "acoshArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Atanh> {
+			static constexpr const char *name		= "atanh";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "atanhArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Exp> {
+			static constexpr const char *name		= "exp";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "expArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Exp2> {
+			static constexpr const char *name		= "exp2";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "exp2Array";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Log> {
+			static constexpr const char *name		= "log";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "logArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Log2> {
+			static constexpr const char *name		= "log2";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "log2Array";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Log10> {
+			static constexpr const char *name		= "log10";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "log10Array";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Sqrt> {
+			static constexpr const char *name		= "sqrt";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "sqrtArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Cbrt> {
+			static constexpr const char *name		= "cbrt";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "cbrtArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Abs> {
+			static constexpr const char *name		= "abs";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "absArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Floor> {
+			static constexpr const char *name		= "floor";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "floorArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::Ceil> {
+			static constexpr const char *name		= "ceil";
+			static constexpr const char *filename	= "math";
+			static constexpr const char *kernelName = "ceilArray";
+			LIBRAPID_UNARY_KERNEL_GETTER
+			LIBRAPID_UNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::MultiplyAdd> {
+			static constexpr const char *name = "multiplyAdd";
+			LIBRAPID_TERNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::MultiplySubtract> {
+			static constexpr const char *name = "multiplySubtract";
+			LIBRAPID_TERNARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::NegativeMultiplyAdd> {
+			static constexpr const char *name = "negativeMultiplyAdd";
+			LIBRAPID_TERNARY_SHAPE_EXTRACTOR
+		};
 	} // namespace typetraits
 
 	namespace array {
 		/// \brief Element-wise array addition
 		///
-		/// Performs element-wise addition on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise addition on two arrays. Their shapes must be broadcast-compatible
+		/// (see broadcastShape) and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -321,9 +827,11 @@ namespace librapid {
 											  ::librapid::detail::LibRapidType::Scalar),
 										   int> = 0>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
-		operator+(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
-		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::Plus, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+		operator+(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT {
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Plus>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -335,16 +843,15 @@ namespace librapid {
 											  ::librapid::detail::LibRapidType::Scalar),
 										   int> = 0>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
-		operator+(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
-		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::Plus, LHS, RHS> {
+		operator+(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT {
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Plus>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
 
 		/// \brief Element-wise array subtraction
 		///
-		/// Performs element-wise subtraction on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise subtraction on two arrays. Their shapes must be
+		/// broadcast-compatible (see broadcastShape) and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -358,9 +865,11 @@ namespace librapid {
 											  ::librapid::detail::LibRapidType::Scalar),
 										   int> = 0>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
-		operator-(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
-		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::Minus, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+		operator-(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT {
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Minus>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -372,16 +881,15 @@ namespace librapid {
 											  ::librapid::detail::LibRapidType::Scalar),
 										   int> = 0>
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
-		operator-(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
-		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::Minus, LHS, RHS> {
+		operator-(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT {
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Minus>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
 
 		/// \brief Element-wise array multiplication
 		///
-		/// Performs element-wise multiplication on two arrays. They must both be the same
-		/// size and of the same data type.
+		/// Performs element-wise multiplication on two arrays. Their shapes must be
+		/// broadcast-compatible (see broadcastShape) and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -397,7 +905,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
 		operator*(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
 		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::Multiply, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Multiply>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -417,8 +928,8 @@ namespace librapid {
 
 		/// \brief Element-wise array division
 		///
-		/// Performs element-wise division on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise division on two arrays. Their shapes must be broadcast-compatible
+		/// (see broadcastShape) and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -434,7 +945,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
 		operator/(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
 		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::Divide, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::Divide>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -455,9 +969,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a < b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is less than the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is less
+		/// than the second. Their shapes must be broadcast-compatible (see broadcastShape) and they
+		/// must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -473,7 +987,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
 		operator<(LHS &&lhs, RHS &&rhs) LIBRAPID_RELEASE_NOEXCEPT
 		  ->detail::Function<typetraits::DescriptorType_t<LHS, RHS>, detail::LessThan, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::LessThan>(
 			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
 		}
@@ -494,9 +1011,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a > b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is greater than the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is
+		/// greater than the second. Their shapes must be broadcast-compatible (see broadcastShape)
+		/// and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -512,7 +1029,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>(LHS &&lhs, RHS &&rhs)
 		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
 													  detail::GreaterThan, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::GreaterThan>(std::forward<LHS>(lhs),
 															 std::forward<RHS>(rhs));
@@ -535,9 +1055,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a <= b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is less than or equal to the second. They must both be the same size and of the
-		/// same data type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is less
+		/// than or equal to the second. Their shapes must be broadcast-compatible (see
+		/// broadcastShape) and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -575,9 +1095,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a >= b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is greater than or equal to the second. They must both be the same size and of
-		/// the same data type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is
+		/// greater than or equal to the second. Their shapes must be broadcast-compatible (see
+		/// broadcastShape) and they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -593,7 +1113,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>=(LHS &&lhs, RHS &&rhs)
 		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
 													  detail::GreaterThanEqual, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::GreaterThanEqual>(std::forward<LHS>(lhs),
 																  std::forward<RHS>(rhs));
@@ -616,9 +1139,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a == b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is equal to the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is equal
+		/// to the second. Their shapes must be broadcast-compatible (see broadcastShape) and they
+		/// must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -634,7 +1157,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator==(LHS &&lhs, RHS &&rhs)
 		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
 													  detail::ElementWiseEqual, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::ElementWiseEqual>(std::forward<LHS>(lhs),
 																  std::forward<RHS>(rhs));
@@ -657,9 +1183,9 @@ namespace librapid {
 		/// \brief Element-wise array comparison, checking whether a != b for all a, b in
 		/// input arrays
 		///
-		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is not equal to the second. They must both be the same size and of the same data
-		/// type.
+		/// Performs an element-wise comparison on two arrays, checking if the first value is not
+		/// equal to the second. Their shapes must be broadcast-compatible (see broadcastShape) and
+		/// they must be of the same data type.
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -675,7 +1201,10 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator!=(LHS &&lhs, RHS &&rhs)
 		  LIBRAPID_RELEASE_NOEXCEPT->detail::Function<typetraits::DescriptorType_t<LHS, RHS>,
 													  detail::ElementWiseNotEqual, LHS, RHS> {
-			LIBRAPID_ASSERT(lhs.shape().operator==(rhs.shape()), "Shapes must be equal");
+			LIBRAPID_ASSERT(shapesBroadcastable(lhs.shape(), rhs.shape()),
+							"Shapes {} and {} cannot be broadcast together",
+							lhs.shape().str(),
+							rhs.shape().str());
 			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>,
 										detail::ElementWiseNotEqual>(std::forward<LHS>(lhs),
 																	 std::forward<RHS>(rhs));
@@ -695,6 +1224,48 @@ namespace librapid {
 																	 std::forward<RHS>(rhs));
 		}
 	} // namespace array
+
+	/// Define an element-wise unary function on arrays, views and expressions. The function
+	/// returns a lazily-evaluated Function object, so it can be combined with other operations
+	/// and evaluated in a single (vectorised) pass.
+	/// \tparam VAL Type of the input
+	/// \param val The input array or expression
+	/// \return A Function object representing the operation
+#define LIBRAPID_UNARY_ARRAY_FUNCTION(NAME_, FUNCTOR_)                                             \
+	template<class VAL,                                                                            \
+			 typename std::enable_if_t<typetraits::TypeInfo<std::decay_t<VAL>>::type !=            \
+										 ::librapid::detail::LibRapidType::Scalar,                 \
+									   int> = 0>                                                   \
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto NAME_(VAL &&val) LIBRAPID_RELEASE_NOEXCEPT      \
+	  ->detail::Function<typetraits::DescriptorType_t<VAL>, detail::FUNCTOR_, VAL> {               \
+		return detail::makeFunction<typetraits::DescriptorType_t<VAL>, detail::FUNCTOR_>(          \
+		  std::forward<VAL>(val));                                                                 \
+	}
+
+	LIBRAPID_UNARY_ARRAY_FUNCTION(sin, Sin)		// Element-wise sine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(cos, Cos)		// Element-wise cosine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(tan, Tan)		// Element-wise tangent
+	LIBRAPID_UNARY_ARRAY_FUNCTION(asin, Asin)	// Element-wise arcsine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(acos, Acos)	// Element-wise arccosine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(atan, Atan)	// Element-wise arctangent
+	LIBRAPID_UNARY_ARRAY_FUNCTION(sinh, Sinh)	// Element-wise hyperbolic sine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(cosh, Cosh)	// Element-wise hyperbolic cosine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(tanh, Tanh)	// Element-wise hyperbolic tangent
+	LIBRAPID_UNARY_ARRAY_FUNCTION(asinh, Asinh)	// Element-wise hyperbolic arcsine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(acosh, Acosh)	// Element-wise hyperbolic arccosine
+	LIBRAPID_UNARY_ARRAY_FUNCTION(atanh, Atanh)	// Element-wise hyperbolic arctangent
+	LIBRAPID_UNARY_ARRAY_FUNCTION(exp, Exp)		// Element-wise exponential
+	LIBRAPID_UNARY_ARRAY_FUNCTION(exp2, Exp2)	// Element-wise base-2 exponential
+	LIBRAPID_UNARY_ARRAY_FUNCTION(log, Log)		// Element-wise natural logarithm
+	LIBRAPID_UNARY_ARRAY_FUNCTION(log2, Log2)	// Element-wise base-2 logarithm
+	LIBRAPID_UNARY_ARRAY_FUNCTION(log10, Log10)	// Element-wise base-10 logarithm
+	LIBRAPID_UNARY_ARRAY_FUNCTION(sqrt, Sqrt)	// Element-wise square root
+	LIBRAPID_UNARY_ARRAY_FUNCTION(cbrt, Cbrt)	// Element-wise cube root
+
+	LIBRAPID_UNARY_ARRAY_FUNCTION(abs, Abs)		// Element-wise absolute value
+	LIBRAPID_UNARY_ARRAY_FUNCTION(floor, Floor)	// Element-wise floor
+	LIBRAPID_UNARY_ARRAY_FUNCTION(ceil, Ceil)	// Element-wise ceiling
+#undef LIBRAPID_UNARY_ARRAY_FUNCTION
 } // namespace librapid
 
 #endif // LIBRAPID_ARRAY_OPERATIONS_HPP
\ No newline at end of file
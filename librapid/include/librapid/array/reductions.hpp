@@ -0,0 +1,497 @@
+#ifndef LIBRAPID_ARRAY_REDUCTIONS_HPP
+#define LIBRAPID_ARRAY_REDUCTIONS_HPP
+
+/*
+ * Reductions collapse an array (or any lazily-evaluated expression) into a single value. They
+ * consume expressions directly, so something like sum(a * b) streams through the inputs exactly
+ * once and never allocates a temporary for (a * b).
+ */
+
+#define LIBRAPID_REDUCTION_FUNCTOR(NAME_, IDENTITY_, SCALAR_OP_, PACKET_OP_, HORIZONTAL_)         \
+	struct NAME_ {                                                                                 \
+		template<typename Scalar>                                                                  \
+		LIBRAPID_NODISCARD static LIBRAPID_ALWAYS_INLINE Scalar identity() {                       \
+			return IDENTITY_;                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Scalar>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar operator()(const Scalar &a,               \
+																	const Scalar &b) const {       \
+			return SCALAR_OP_;                                                                     \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(const Packet &a,                   \
+																const Packet &b) const {           \
+			return PACKET_OP_;                                                                     \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto horizontal(const Packet &a) const {         \
+			return HORIZONTAL_;                                                                    \
+		}                                                                                          \
+	}
+
+namespace librapid {
+	namespace detail {
+		LIBRAPID_REDUCTION_FUNCTOR(SumReducer, Scalar(0), a + b, a + b, a.sum());
+		LIBRAPID_REDUCTION_FUNCTOR(ProdReducer, Scalar(1), a * b, a * b, a.product());
+		LIBRAPID_REDUCTION_FUNCTOR(MinReducer, std::numeric_limits<Scalar>::max(),
+								   (b < a ? b : a), Vc::min(a, b), a.min());
+		LIBRAPID_REDUCTION_FUNCTOR(MaxReducer, std::numeric_limits<Scalar>::lowest(),
+								   (a < b ? b : a), Vc::max(a, b), a.max());
+
+		/// Reduce the elements in the range [begin, end) of an array or expression, using a
+		/// single Packet accumulator where possible and finishing the tail with scalar
+		/// operations.
+		/// \tparam Reducer The reduction functor type
+		/// \tparam T The type of the object to reduce
+		/// \param obj The object to reduce
+		/// \param begin The first index to include
+		/// \param end One past the last index to include
+		/// \return The reduction of the range
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto reduceRange(const T &obj, size_t begin,
+																   size_t end) {
+			using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+			using Packet = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr size_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation = typetraits::TypeInfo<T>::allowVectorisation;
+
+			Reducer reducer;
+			Scalar result = Reducer::template identity<Scalar>();
+			size_t index  = begin;
+
+			if constexpr (allowVectorisation) {
+				if (end - begin >= packetWidth) {
+					const size_t vectorEnd = begin + ((end - begin) / packetWidth) * packetWidth;
+					Packet accumulator(Reducer::template identity<Scalar>());
+					for (; index < vectorEnd; index += packetWidth) {
+						accumulator = reducer.packet(accumulator, obj.packet(index));
+					}
+					result = static_cast<Scalar>(reducer.horizontal(accumulator));
+				}
+			}
+
+			// Reduce the remaining elements
+			for (; index < end; ++index) { result = reducer(result, obj.scalar(index)); }
+			return result;
+		}
+
+		/// Combine a set of partial results pairwise, in a binary tree. This keeps the depth of
+		/// the combination logarithmic, which also helps the accuracy of floating point sums.
+		/// \tparam Reducer The reduction functor type
+		/// \tparam Scalar The type of the partial results
+		/// \param partials The partial results. This is modified in place
+		/// \return The combined result
+		template<typename Reducer, typename Scalar>
+		LIBRAPID_NODISCARD Scalar treeCombine(std::vector<Scalar> &partials) {
+			Reducer reducer;
+			const size_t count = partials.size();
+			for (size_t stride = 1; stride < count; stride *= 2) {
+				for (size_t i = 0; i + stride < count; i += stride * 2) {
+					partials[i] = reducer(partials[i], partials[i + stride]);
+				}
+			}
+			return count > 0 ? partials[0] : Reducer::template identity<Scalar>();
+		}
+
+		/// Reduce every element of an array or expression into a single value. If the object is
+		/// large enough, it is split into contiguous, packet-aligned chunks which are reduced in
+		/// parallel and then combined with treeCombine.
+		/// \tparam Reducer The reduction functor type
+		/// \tparam T The type of the object to reduce
+		/// \param obj The object to reduce
+		/// \return The result of the reduction
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto reduce(const T &obj) {
+			using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+			using Device = typename typetraits::TypeInfo<T>::Device;
+			constexpr size_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+			static_assert(std::is_same_v<Device, device::CPU>,
+						  "Reductions are currently only supported for CPU arrays");
+
+			const size_t size = obj.shape().size();
+
+#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+			if (static_cast<int64_t>(size) > global::multithreadThreshold &&
+				global::numThreads > 1) {
+				// Chunks are a multiple of the packet width, so only the final chunk has a
+				// scalar tail
+				const size_t packets   = (size + packetWidth - 1) / packetWidth;
+				const int64_t threads  = static_cast<int64_t>(
+				   ::librapid::min(static_cast<size_t>(global::numThreads), packets));
+				const size_t chunkSize = ((packets + threads - 1) / threads) * packetWidth;
+
+				std::vector<Scalar> partials(threads);
+
+#	pragma omp parallel for shared(obj, partials, threads, chunkSize, size) default(none)         \
+	  num_threads(threads)
+				for (int64_t thread = 0; thread < threads; ++thread) {
+					const size_t begin = ::librapid::min(thread * chunkSize, size);
+					const size_t end   = ::librapid::min(begin + chunkSize, size);
+					partials[thread]   = reduceRange<Reducer>(obj, begin, end);
+				}
+
+				return treeCombine<Reducer>(partials);
+			}
+#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+
+			return reduceRange<Reducer>(obj, 0, size);
+		}
+
+		/// Reduce a block of columns [begin, end) across every row of a (length x inner) slab of
+		/// an array or expression, accumulating whole rows of packets into the output. Memory is
+		/// always read contiguously, rather than with a stride of \p inner.
+		/// \tparam Reducer The reduction functor type
+		/// \tparam T The type of the object to reduce
+		/// \tparam Result The type of the output array
+		/// \param obj The object to reduce
+		/// \param result The output array
+		/// \param srcOffset The index of the first element of the slab in \p obj
+		/// \param dstOffset The index of the first output element for the slab
+		/// \param begin The first column to reduce
+		/// \param end One past the last column to reduce
+		/// \param length The number of rows in the slab (the length of the reduced axis)
+		/// \param inner The number of columns in the slab
+		template<typename Reducer, typename T, typename Result>
+		LIBRAPID_ALWAYS_INLINE void reduceRows(const T &obj, Result &result, size_t srcOffset,
+											   size_t dstOffset, size_t begin, size_t end,
+											   size_t length, size_t inner) {
+			using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+			constexpr size_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation = typetraits::TypeInfo<T>::allowVectorisation;
+
+			Reducer reducer;
+			for (size_t i = begin; i < end; ++i) {
+				result.write(dstOffset + i, Reducer::template identity<Scalar>());
+			}
+
+			for (size_t row = 0; row < length; ++row) {
+				const size_t rowOffset = srcOffset + row * inner;
+				size_t i			   = begin;
+
+				if constexpr (allowVectorisation) {
+					for (; i + packetWidth <= end; i += packetWidth) {
+						result.writePacket(
+						  dstOffset + i,
+						  reducer.packet(result.packet(dstOffset + i), obj.packet(rowOffset + i)));
+					}
+				}
+
+				for (; i < end; ++i) {
+					result.write(dstOffset + i,
+								 reducer(result.scalar(dstOffset + i), obj.scalar(rowOffset + i)));
+				}
+			}
+		}
+
+		/// Combine the elements [begin, end) of one partial result of an axis reduction into
+		/// another
+		/// \tparam Reducer The reduction functor type
+		/// \tparam Result The type of the partial results
+		/// \param dst The partial result to combine into
+		/// \param src The partial result to combine with \p dst
+		/// \param begin The first element to combine
+		/// \param end One past the last element to combine
+		template<typename Reducer, typename Result>
+		LIBRAPID_ALWAYS_INLINE void combinePartials(Result &dst, const Result &src, size_t begin,
+													size_t end) {
+			using Scalar = typename typetraits::TypeInfo<Result>::Scalar;
+			constexpr size_t packetWidth	  = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr bool allowVectorisation = typetraits::TypeInfo<Result>::allowVectorisation;
+
+			Reducer reducer;
+			size_t i = begin;
+			if constexpr (allowVectorisation) {
+				for (; i + packetWidth <= end; i += packetWidth) {
+					dst.writePacket(i, reducer.packet(dst.packet(i), src.packet(i)));
+				}
+			}
+			for (; i < end; ++i) dst.write(i, reducer(dst.scalar(i), src.scalar(i)));
+		}
+
+		/// Reduce an array or expression along a single axis. The input is treated as a
+		/// (outer x length x inner) block, where length is the size of the reduced axis:
+		///  - If the reduced axis is the innermost one (inner == 1), each output element is a
+		///    horizontal SIMD reduction over one contiguous row.
+		///  - Otherwise, rows of length \p inner are accumulated into the output one packet at a
+		///    time, in column blocks small enough for the partial results to remain in cache.
+		///    If there are fewer (slab, column block) pairs than threads -- as when reducing
+		///    axis 0 of a tall, narrow matrix -- the reduced axis is also split between the
+		///    threads. Each split accumulates into its own partial result, and the partial
+		///    results are combined pairwise at the end, as treeCombine does.
+		///
+		/// The input is consumed lazily, so reducing an expression does not create a temporary.
+		/// \tparam Reducer The reduction functor type
+		/// \tparam T The type of the object to reduce
+		/// \param obj The object to reduce
+		/// \param axis The axis to reduce. Negative values count from the last axis
+		/// \return An Array with the reduced axis removed
+		template<typename Reducer, typename T>
+		LIBRAPID_NODISCARD auto reduceAxis(const T &obj, int64_t axis) {
+			using Scalar	= typename typetraits::TypeInfo<T>::Scalar;
+			using Device	= typename typetraits::TypeInfo<T>::Device;
+			using ShapeType = Shape<size_t, 32>;
+
+			static_assert(std::is_same_v<Device, device::CPU>,
+						  "Reductions are currently only supported for CPU arrays");
+
+			const ShapeType shape = obj.shape();
+			const int64_t dims	  = static_cast<int64_t>(shape.ndim());
+			if (axis < 0) axis += dims;
+			LIBRAPID_ASSERT(axis >= 0 && axis < dims,
+							"Axis {} is out of range for an array with {} dimensions",
+							axis,
+							dims);
+
+			const Stride<size_t, 32> stride(shape);
+			const size_t length = shape[axis];
+			const size_t inner	= stride[axis];
+			size_t outer		= 1;
+			for (int64_t i = 0; i < axis; ++i) outer *= shape[i];
+
+			ShapeType resultShape = ShapeType::zeros(dims - 1);
+			for (int64_t i = 0, j = 0; i < dims; ++i) {
+				if (i != axis) resultShape[j++] = shape[i];
+			}
+
+			Array<Scalar, device::CPU> result(resultShape);
+
+			bool parallel = false;
+#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+			const auto elements = static_cast<int64_t>(shape.size());
+			parallel = elements > global::multithreadThreshold && global::numThreads > 1;
+#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+
+			if (inner == 1) {
+				const auto rows = static_cast<int64_t>(outer);
+
+#pragma omp parallel for shared(obj, result, rows, length) default(none) if (parallel)             \
+  num_threads(global::numThreads)
+				for (int64_t row = 0; row < rows; ++row) {
+					result.write(row, reduceRange<Reducer>(obj, row * length, (row + 1) * length));
+				}
+			} else {
+				// 16KiB of partial results per task fits comfortably in L1 cache, and is a
+				// multiple of every packet width
+				constexpr size_t blockSize = 16384 / sizeof(Scalar);
+				const size_t blocks		   = (inner + blockSize - 1) / blockSize;
+				const auto tasks		   = static_cast<int64_t>(outer * blocks);
+
+				size_t splits = 1;
+				if (parallel && tasks < global::numThreads) {
+					splits = ::librapid::min(
+					  static_cast<size_t>((global::numThreads + tasks - 1) / tasks), length);
+				}
+
+				if (splits == 1) {
+#pragma omp parallel for shared(obj, result, tasks, blocks, length, inner) default(none)           \
+  if (parallel) num_threads(global::numThreads)
+					for (int64_t task = 0; task < tasks; ++task) {
+						const size_t slab  = task / blocks;
+						const size_t begin = (task % blocks) * blockSize;
+						const size_t end   = ::librapid::min(begin + blockSize, inner);
+						reduceRows<Reducer>(obj,
+											result,
+											slab * length * inner,
+											slab * inner,
+											begin,
+											end,
+											length,
+											inner);
+					}
+				} else {
+					// The first split accumulates straight into the result
+					std::vector<Array<Scalar, device::CPU>> extra(
+					  splits - 1, Array<Scalar, device::CPU>(resultShape));
+					std::vector<Array<Scalar, device::CPU> *> partials = {&result};
+					for (auto &partial : extra) partials.push_back(&partial);
+
+					const size_t splitLength = (length + splits - 1) / splits;
+					const auto splitTasks	 = static_cast<int64_t>(tasks * splits);
+
+#pragma omp parallel for shared(obj, partials, tasks, blocks, length, inner, splitLength,          \
+								splitTasks) default(none) num_threads(global::numThreads)
+					for (int64_t task = 0; task < splitTasks; ++task) {
+						const size_t split	  = task / tasks;
+						const size_t slab	  = (task % tasks) / blocks;
+						const size_t begin	  = (task % blocks) * blockSize;
+						const size_t end	  = ::librapid::min(begin + blockSize, inner);
+						const size_t rowBegin = ::librapid::min(split * splitLength, length);
+						const size_t rowEnd	  = ::librapid::min(rowBegin + splitLength, length);
+						reduceRows<Reducer>(obj,
+											*partials[split],
+											slab * length * inner + rowBegin * inner,
+											slab * inner,
+											begin,
+											end,
+											rowEnd - rowBegin,
+											inner);
+					}
+
+#pragma omp parallel for shared(partials, tasks, blocks, inner, splits) default(none)              \
+  num_threads(global::numThreads)
+					for (int64_t task = 0; task < tasks; ++task) {
+						const size_t begin = (task / blocks) * inner + (task % blocks) * blockSize;
+						const size_t end =
+						  (task / blocks) * inner +
+						  ::librapid::min((task % blocks) * blockSize + blockSize, inner);
+						for (size_t stride = 1; stride < splits; stride *= 2) {
+							for (size_t i = 0; i + stride < splits; i += stride * 2) {
+								combinePartials<Reducer>(
+								  *partials[i], *partials[i + stride], begin, end);
+							}
+						}
+					}
+				}
+			}
+
+			return result;
+		}
+	} // namespace detail
+
+	/// Compute the sum of all elements in an array or expression. Expressions are evaluated on
+	/// the fly, so no temporary arrays are created.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \return The sum of all elements
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto sum(const T &val) {
+		return detail::reduce<detail::SumReducer>(val);
+	}
+
+	/// Compute the sum of the elements of an array or expression along an axis. Reducing
+	/// axis 0 of a row-major matrix accumulates whole rows, so memory is never traversed with a
+	/// large stride.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \param axis The axis to reduce. Negative values count from the last axis
+	/// \return An Array with the reduced axis removed
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto sum(const T &val, int64_t axis) {
+		return detail::reduceAxis<detail::SumReducer>(val, axis);
+	}
+
+	/// Compute the product of all elements in an array or expression.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \return The product of all elements
+	/// \sa sum
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto prod(const T &val) {
+		return detail::reduce<detail::ProdReducer>(val);
+	}
+
+	/// Compute the product of the elements of an array or expression along an axis.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \param axis The axis to reduce. Negative values count from the last axis
+	/// \return An Array with the reduced axis removed
+	/// \sa sum(const T &, int64_t)
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto prod(const T &val, int64_t axis) {
+		return detail::reduceAxis<detail::ProdReducer>(val, axis);
+	}
+
+	/// Find the smallest element in an array or expression.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \return The smallest element
+	/// \sa sum
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto min(const T &val) {
+		return detail::reduce<detail::MinReducer>(val);
+	}
+
+	/// Find the smallest elements of an array or expression along an axis.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \param axis The axis to reduce. Negative values count from the last axis
+	/// \return An Array with the reduced axis removed
+	/// \sa sum(const T &, int64_t)
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto min(const T &val, int64_t axis) {
+		return detail::reduceAxis<detail::MinReducer>(val, axis);
+	}
+
+	/// Find the largest element in an array or expression.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \return The largest element
+	/// \sa sum
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto max(const T &val) {
+		return detail::reduce<detail::MaxReducer>(val);
+	}
+
+	/// Find the largest elements of an array or expression along an axis.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \param axis The axis to reduce. Negative values count from the last axis
+	/// \return An Array with the reduced axis removed
+	/// \sa sum(const T &, int64_t)
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto max(const T &val, int64_t axis) {
+		return detail::reduceAxis<detail::MaxReducer>(val, axis);
+	}
+
+	/// Compute the arithmetic mean of all elements in an array or expression. The mean of an
+	/// integer array is returned as a double.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \return The mean of all elements
+	/// \sa sum
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto mean(const T &val) {
+		using Scalar	  = typename typetraits::TypeInfo<T>::Scalar;
+		const auto result = sum(val);
+		const size_t size = val.shape().size();
+		if constexpr (std::is_integral_v<Scalar>) {
+			return static_cast<double>(result) / static_cast<double>(size);
+		} else {
+			return result / static_cast<Scalar>(size);
+		}
+	}
+
+	/// Compute the arithmetic mean of the elements of an array or expression along an axis. The
+	/// mean of an integer array is returned as an array of doubles.
+	/// \tparam T The type of the object to reduce
+	/// \param val The array or expression
+	/// \param axis The axis to reduce. Negative values count from the last axis
+	/// \return An Array with the reduced axis removed
+	/// \sa sum(const T &, int64_t)
+	template<typename T, typename std::enable_if_t<
+						   typetraits::TypeInfo<T>::type != detail::LibRapidType::Scalar, int> = 0>
+	LIBRAPID_NODISCARD auto mean(const T &val, int64_t axis) {
+		using Scalar		= typename typetraits::TypeInfo<T>::Scalar;
+		const auto dims		= static_cast<int64_t>(val.shape().ndim());
+		const size_t length = val.shape()[axis < 0 ? axis + dims : axis];
+		auto result			= sum(val, axis);
+
+		if constexpr (std::is_integral_v<Scalar>) {
+			Array<double, device::CPU> res(result.shape());
+			const size_t size = result.shape().size();
+			for (size_t i = 0; i < size; ++i) {
+				res.write(i, static_cast<double>(result.scalar(i)) / static_cast<double>(length));
+			}
+			return res;
+		} else {
+			return (result / static_cast<Scalar>(length)).eval();
+		}
+	}
+} // namespace librapid
+
+#undef LIBRAPID_REDUCTION_FUNCTOR
+
+#endif // LIBRAPID_ARRAY_REDUCTIONS_HPP
@@ -331,6 +331,67 @@ namespace librapid {
 		}
 	}
 
+	/// Returns true if two shapes can be broadcast together. Following NumPy's rules, shapes are
+	/// aligned on their trailing dimensions, and each pair of dimensions must either be equal or
+	/// contain a one. Missing leading dimensions are treated as ones.
+	/// \tparam T1 Type of the first input
+	/// \tparam N1 Number of dimensions of the first input
+	/// \tparam T2 Type of the second input
+	/// \tparam N2 Number of dimensions of the second input
+	/// \param first First input
+	/// \param second Second input
+	/// \return True if the shapes are broadcast-compatible, false otherwise
+	template<typename T1, size_t N1, typename T2, size_t N2>
+	LIBRAPID_NODISCARD LIBRAPID_INLINE bool shapesBroadcastable(const Shape<T1, N1> &first,
+																const Shape<T2, N2> &second) {
+		const int64_t firstDims	 = static_cast<int64_t>(first.ndim());
+		const int64_t secondDims = static_cast<int64_t>(second.ndim());
+		const int64_t dims		 = ::librapid::max(firstDims, secondDims);
+
+		for (int64_t i = 1; i <= dims; ++i) {
+			const auto a = i <= firstDims ? static_cast<size_t>(first[firstDims - i]) : 1;
+			const auto b = i <= secondDims ? static_cast<size_t>(second[secondDims - i]) : 1;
+			if (a != b && a != 1 && b != 1) return false;
+		}
+
+		return true;
+	}
+
+	/// Compute the shape resulting from broadcasting two shapes together (see
+	/// shapesBroadcastable).
+	/// \tparam T1 Type of the first input
+	/// \tparam N1 Number of dimensions of the first input
+	/// \tparam T2 Type of the second input
+	/// \tparam N2 Number of dimensions of the second input
+	/// \param first First input
+	/// \param second Second input
+	/// \return The broadcast shape
+	/// \sa shapesBroadcastable
+	template<typename T1, size_t N1, typename T2, size_t N2>
+	LIBRAPID_NODISCARD LIBRAPID_INLINE auto broadcastShape(const Shape<T1, N1> &first,
+														   const Shape<T2, N2> &second)
+	  -> Shape<T1, N1> {
+		if (first == second) return first;
+
+		LIBRAPID_ASSERT(shapesBroadcastable(first, second),
+						"Shapes {} and {} cannot be broadcast together",
+						first.str(),
+						second.str());
+
+		const int64_t firstDims	 = static_cast<int64_t>(first.ndim());
+		const int64_t secondDims = static_cast<int64_t>(second.ndim());
+		const int64_t dims		 = ::librapid::max(firstDims, secondDims);
+
+		auto res = Shape<T1, N1>::zeros(dims);
+		for (int64_t i = 1; i <= dims; ++i) {
+			const auto a  = i <= firstDims ? static_cast<T1>(first[firstDims - i]) : T1(1);
+			const auto b  = i <= secondDims ? static_cast<T1>(second[secondDims - i]) : T1(1);
+			res[dims - i] = a == 1 ? b : a;
+		}
+
+		return res;
+	}
+
 	namespace typetraits {
 		template<typename T>
 		struct IsSizeType {
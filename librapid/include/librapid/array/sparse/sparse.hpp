@@ -0,0 +1,7 @@
+#ifndef LIBRAPID_ARRAY_SPARSE
+#define LIBRAPID_ARRAY_SPARSE
+
+#include "sparseArray.hpp"
+#include "sparseMultiply.hpp"
+
+#endif // LIBRAPID_ARRAY_SPARSE
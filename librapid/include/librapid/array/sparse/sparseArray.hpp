@@ -0,0 +1,330 @@
+#ifndef LIBRAPID_ARRAY_SPARSE_SPARSE_ARRAY_HPP
+#define LIBRAPID_ARRAY_SPARSE_SPARSE_ARRAY_HPP
+
+/*
+ * This file defines the SparseArray class, which stores a two-dimensional matrix in compressed
+ * sparse row (CSR) format. Only the nonzero elements are stored, along with their column indices
+ * and the offset of the first nonzero element of each row.
+ */
+
+namespace librapid {
+	/// A sparse matrix in compressed sparse row (CSR) format. The nonzero elements of row i are
+	/// stored in values()[rowOffsets()[i]] to values()[rowOffsets()[i + 1] - 1], sorted by column,
+	/// with their columns in the same positions of columnIndices(). Matrices are built from
+	/// coordinate (COO) triplets, and can be multiplied by dense arrays with matmul.
+	/// \tparam Scalar_ The scalar type of the nonzero elements
+	/// \tparam Index_ The integer type used to store row offsets and column indices
+	template<typename Scalar_, typename Index_ = int64_t>
+	class SparseArray {
+	public:
+		using Scalar	= Scalar_;
+		using Index		= Index_;
+		using ShapeType = Shape<size_t, 32>;
+
+		static_assert(std::is_integral_v<Index> && std::is_signed_v<Index>,
+					  "SparseArray indices must be signed integers");
+
+		/// Default constructor (an empty 0 x 0 matrix)
+		SparseArray() = default;
+
+		/// Create a matrix with no nonzero elements
+		/// \param rows The number of rows
+		/// \param cols The number of columns
+		LIBRAPID_ALWAYS_INLINE SparseArray(int64_t rows, int64_t cols);
+
+		/// Create a matrix from coordinate (COO) triplets, where element (rows[i], cols[i]) has
+		/// the value values[i]. The triplets may be in any order, and duplicate coordinates are
+		/// summed.
+		/// \param shape The shape of the matrix ({rows, columns})
+		/// \param rows The row of each element
+		/// \param cols The column of each element
+		/// \param values The value of each element
+		LIBRAPID_ALWAYS_INLINE SparseArray(const ShapeType &shape, const std::vector<Index> &rows,
+										   const std::vector<Index> &cols,
+										   const std::vector<Scalar> &values);
+
+		LIBRAPID_ALWAYS_INLINE SparseArray(const SparseArray &other)			 = default;
+		LIBRAPID_ALWAYS_INLINE SparseArray(SparseArray &&other) noexcept		 = default;
+		LIBRAPID_ALWAYS_INLINE SparseArray &operator=(const SparseArray &other)	 = default;
+		LIBRAPID_ALWAYS_INLINE SparseArray &operator=(SparseArray &&other) noexcept = default;
+
+		/// Create a matrix from existing CSR arrays, which are moved into the SparseArray. The
+		/// columns within each row must be sorted and unique.
+		/// \param shape The shape of the matrix ({rows, columns})
+		/// \param rowOffsets The offset of the first element of each row (rows + 1 elements)
+		/// \param columnIndices The column of each nonzero element
+		/// \param values The value of each nonzero element
+		/// \return The sparse matrix
+		LIBRAPID_NODISCARD static SparseArray fromCSR(const ShapeType &shape,
+													  std::vector<Index> &&rowOffsets,
+													  std::vector<Index> &&columnIndices,
+													  std::vector<Scalar> &&values);
+
+		/// Create a sparse copy of a dense two-dimensional array, storing only its nonzero
+		/// elements
+		/// \tparam T The type of the dense array
+		/// \param dense The array to convert
+		/// \return The sparse matrix
+		template<typename T>
+		LIBRAPID_NODISCARD static SparseArray fromDense(const T &dense);
+
+		/// Return the shape of the matrix ({rows, columns})
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ShapeType shape() const;
+
+		/// Return the number of rows in the matrix
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t rows() const { return m_rows; }
+
+		/// Return the number of columns in the matrix
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t cols() const { return m_cols; }
+
+		/// Return the number of stored (nonzero) elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t nnz() const;
+
+		/// Return the offset of the first element of each row, followed by nnz()
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::vector<Index> &rowOffsets() const;
+
+		/// Return the column of each stored element
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::vector<Index> &columnIndices() const;
+
+		/// Return the value of each stored element
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::vector<Scalar> &values() const;
+
+		/// Return the value of each stored element. The sparsity pattern cannot be changed, but
+		/// the values can be modified in place.
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE std::vector<Scalar> &values();
+
+		/// Return the element at (row, col), which is zero if it is not stored. The columns of
+		/// the row are binary searched.
+		/// \param row The row of the element
+		/// \param col The column of the element
+		/// \return The value of the element
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar get(int64_t row, int64_t col) const;
+
+		/// Return a dense copy of the matrix
+		/// \return The dense array
+		LIBRAPID_NODISCARD auto toDense() const;
+
+	private:
+		/// Return one dimension of the shape of a matrix, checking first that the shape is
+		/// two-dimensional
+		/// \param shape The shape of the matrix
+		/// \param axis The dimension to return (0 or 1)
+		/// \return The length of the dimension
+		LIBRAPID_NODISCARD static int64_t dimension(const ShapeType &shape, int64_t axis) {
+			LIBRAPID_ASSERT(shape.ndim() == 2, "SparseArray must be two-dimensional");
+			return static_cast<int64_t>(shape[axis]);
+		}
+
+		int64_t m_rows = 0;
+		int64_t m_cols = 0;
+		std::vector<Index> m_rowOffsets = {Index(0)};
+		std::vector<Index> m_columnIndices;
+		std::vector<Scalar> m_values;
+	};
+
+	template<typename Scalar_, typename Index_>
+	SparseArray<Scalar_, Index_>::SparseArray(int64_t rows, int64_t cols) :
+			m_rows(rows), m_cols(cols), m_rowOffsets(rows + 1, Index(0)) {}
+
+	template<typename Scalar_, typename Index_>
+	SparseArray<Scalar_, Index_>::SparseArray(const ShapeType &shape,
+											  const std::vector<Index> &rows,
+											  const std::vector<Index> &cols,
+											  const std::vector<Scalar> &values) :
+			SparseArray(dimension(shape, 0), dimension(shape, 1)) {
+		LIBRAPID_ASSERT(rows.size() == cols.size() && rows.size() == values.size(),
+						"Triplet arrays must have the same length");
+
+		const int64_t numTriplets = static_cast<int64_t>(values.size());
+
+		// Counting sort by row, so the triplets of each row are contiguous
+		for (int64_t i = 0; i < numTriplets; ++i) {
+			LIBRAPID_ASSERT(rows[i] >= 0 && rows[i] < m_rows, "Row index {} out of range", rows[i]);
+			LIBRAPID_ASSERT(
+			  cols[i] >= 0 && cols[i] < m_cols, "Column index {} out of range", cols[i]);
+			++m_rowOffsets[rows[i] + 1];
+		}
+		for (int64_t row = 0; row < m_rows; ++row) {
+			m_rowOffsets[row + 1] += m_rowOffsets[row];
+		}
+
+		std::vector<Index> insert(m_rowOffsets.begin(), m_rowOffsets.end() - 1);
+		m_columnIndices.resize(numTriplets);
+		m_values.resize(numTriplets);
+		for (int64_t i = 0; i < numTriplets; ++i) {
+			const Index dst		 = insert[rows[i]]++;
+			m_columnIndices[dst] = cols[i];
+			m_values[dst]		 = values[i];
+		}
+
+		// Sort each row by column and sum duplicates, recording the new length of the row
+		std::vector<Index> rowLengths(m_rows);
+		const int64_t numRows = m_rows;
+		const Index *offsets  = m_rowOffsets.data();
+		Index *columns		  = m_columnIndices.data();
+		Scalar *vals		  = m_values.data();
+		Index *lengths		  = rowLengths.data();
+
+#pragma omp parallel for shared(numRows, offsets, columns, vals, lengths) default(none)            \
+  num_threads(global::numThreads) schedule(dynamic, 256)                                           \
+  if (numTriplets > global::multithreadThreshold)
+		for (int64_t row = 0; row < numRows; ++row) {
+			const Index begin = offsets[row];
+			const Index end	  = offsets[row + 1];
+
+			bool sorted = true;
+			for (Index i = begin + 1; i < end && sorted; ++i) {
+				sorted = columns[i - 1] < columns[i];
+			}
+
+			if (!sorted) {
+				std::vector<std::pair<Index, Scalar>> entries(end - begin);
+				for (Index i = begin; i < end; ++i) { entries[i - begin] = {columns[i], vals[i]}; }
+				std::stable_sort(entries.begin(),
+								 entries.end(),
+								 [](const auto &a, const auto &b) { return a.first < b.first; });
+
+				Index length = 0;
+				for (const auto &[column, value] : entries) {
+					if (length > 0 && columns[begin + length - 1] == column) {
+						vals[begin + length - 1] += value;
+					} else {
+						columns[begin + length] = column;
+						vals[begin + length]	= value;
+						++length;
+					}
+				}
+				lengths[row] = length;
+			} else {
+				lengths[row] = end - begin;
+			}
+		}
+
+		// Remove the gaps left by merged duplicates
+		Index length = 0;
+		for (int64_t row = 0; row < m_rows; ++row) {
+			const Index begin = m_rowOffsets[row];
+			if (begin != length) {
+				std::copy(m_columnIndices.begin() + begin,
+						  m_columnIndices.begin() + begin + rowLengths[row],
+						  m_columnIndices.begin() + length);
+				std::copy(m_values.begin() + begin,
+						  m_values.begin() + begin + rowLengths[row],
+						  m_values.begin() + length);
+			}
+			m_rowOffsets[row] = length;
+			length += rowLengths[row];
+		}
+		m_rowOffsets[m_rows] = length;
+		m_columnIndices.resize(length);
+		m_values.resize(length);
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::fromCSR(const ShapeType &shape,
+											   std::vector<Index> &&rowOffsets,
+											   std::vector<Index> &&columnIndices,
+											   std::vector<Scalar> &&values) -> SparseArray {
+		LIBRAPID_ASSERT(shape.ndim() == 2, "SparseArray must be two-dimensional");
+		LIBRAPID_ASSERT(rowOffsets.size() == shape[0] + 1,
+						"Expected {} row offsets, but received {}",
+						shape[0] + 1,
+						rowOffsets.size());
+		LIBRAPID_ASSERT(columnIndices.size() == values.size() &&
+						  static_cast<int64_t>(values.size()) == rowOffsets.back(),
+						"Column indices and values must have one element per nonzero");
+
+		SparseArray res;
+		res.m_rows			= shape[0];
+		res.m_cols			= shape[1];
+		res.m_rowOffsets	= std::move(rowOffsets);
+		res.m_columnIndices = std::move(columnIndices);
+		res.m_values		= std::move(values);
+		return res;
+	}
+
+	template<typename Scalar_, typename Index_>
+	template<typename T>
+	auto SparseArray<Scalar_, Index_>::fromDense(const T &dense) -> SparseArray {
+		if constexpr (typetraits::TypeInfo<T>::type != detail::LibRapidType::ArrayContainer) {
+			return fromDense(detail::evalTemporary(dense));
+		} else {
+			LIBRAPID_ASSERT(dense.shape().ndim() == 2, "SparseArray must be two-dimensional");
+			const int64_t rows = dense.shape()[0];
+			const int64_t cols = dense.shape()[1];
+			const auto *data   = dense.storage().begin();
+
+			std::vector<Index> rowOffsets(rows + 1, Index(0));
+			std::vector<Index> columnIndices;
+			std::vector<Scalar> values;
+			for (int64_t row = 0; row < rows; ++row) {
+				for (int64_t col = 0; col < cols; ++col) {
+					const Scalar value = static_cast<Scalar>(data[row * cols + col]);
+					if (value == Scalar(0)) continue;
+					columnIndices.push_back(static_cast<Index>(col));
+					values.push_back(value);
+				}
+				rowOffsets[row + 1] = static_cast<Index>(values.size());
+			}
+
+			return fromCSR(
+			  dense.shape(), std::move(rowOffsets), std::move(columnIndices), std::move(values));
+		}
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::shape() const -> ShapeType {
+		return ShapeType({static_cast<size_t>(m_rows), static_cast<size_t>(m_cols)});
+	}
+
+	template<typename Scalar_, typename Index_>
+	int64_t SparseArray<Scalar_, Index_>::nnz() const {
+		return static_cast<int64_t>(m_values.size());
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::rowOffsets() const -> const std::vector<Index> & {
+		return m_rowOffsets;
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::columnIndices() const -> const std::vector<Index> & {
+		return m_columnIndices;
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::values() const -> const std::vector<Scalar> & {
+		return m_values;
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::values() -> std::vector<Scalar> & {
+		return m_values;
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::get(int64_t row, int64_t col) const -> Scalar {
+		LIBRAPID_ASSERT(row >= 0 && row < m_rows, "Row index {} out of range", row);
+		LIBRAPID_ASSERT(col >= 0 && col < m_cols, "Column index {} out of range", col);
+
+		const auto begin = m_columnIndices.begin() + m_rowOffsets[row];
+		const auto end	 = m_columnIndices.begin() + m_rowOffsets[row + 1];
+		const auto it	 = std::lower_bound(begin, end, static_cast<Index>(col));
+		if (it == end || *it != col) return Scalar(0);
+		return m_values[it - m_columnIndices.begin()];
+	}
+
+	template<typename Scalar_, typename Index_>
+	auto SparseArray<Scalar_, Index_>::toDense() const {
+		Array<Scalar> res(shape(), Scalar(0));
+		Scalar *data = res.storage().begin();
+		for (int64_t row = 0; row < m_rows; ++row) {
+			for (Index i = m_rowOffsets[row]; i < m_rowOffsets[row + 1]; ++i) {
+				data[row * m_cols + m_columnIndices[i]] = m_values[i];
+			}
+		}
+		return res;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SPARSE_SPARSE_ARRAY_HPP
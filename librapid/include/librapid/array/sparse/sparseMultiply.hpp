@@ -0,0 +1,282 @@
+#ifndef LIBRAPID_ARRAY_SPARSE_SPARSE_MULTIPLY_HPP
+#define LIBRAPID_ARRAY_SPARSE_SPARSE_MULTIPLY_HPP
+
+namespace librapid {
+	namespace detail {
+		/// Split the rows of a CSR matrix into \p parts contiguous ranges of roughly equal cost,
+		/// where the cost of a row is its number of nonzero elements plus one (for writing its
+		/// result). In graphs with a power-law degree distribution, splitting by the number of
+		/// rows would leave most of the work to a few threads.
+		/// \tparam Index The index type of the matrix
+		/// \param rowOffsets The row offsets of the matrix (rows + 1 elements)
+		/// \param rows The number of rows
+		/// \param parts The number of ranges to split the rows into
+		/// \return The first row of each range, followed by \p rows
+		template<typename Index>
+		LIBRAPID_NODISCARD std::vector<int64_t> partitionSparseRows(const Index *rowOffsets,
+																	int64_t rows, int64_t parts) {
+			std::vector<int64_t> bounds(parts + 1, rows);
+			bounds[0] = 0;
+
+			// The cost of the rows before row i is rowOffsets[i] + i, which is strictly increasing,
+			// so each boundary can be binary searched. The remaining cost is divided evenly
+			// between the remaining parts, so a single expensive row only unbalances its own part.
+			auto cost = [rowOffsets](int64_t row) {
+				return static_cast<int64_t>(rowOffsets[row]) + row;
+			};
+			const int64_t total = cost(rows);
+			for (int64_t part = 1; part < parts; ++part) {
+				const int64_t done	 = cost(bounds[part - 1]);
+				const int64_t target = done + (total - done) / (parts - part + 1);
+				int64_t low = bounds[part - 1], high = rows;
+				while (low < high) {
+					const int64_t mid = low + (high - low) / 2;
+					if (cost(mid) < target) {
+						low = mid + 1;
+					} else {
+						high = mid;
+					}
+				}
+				bounds[part] = low;
+			}
+
+			return bounds;
+		}
+
+		/// Evaluates as true if a sparse product on these types is passed to an external sparse
+		/// BLAS library (when one is available). cxxblas only dispatches float and double
+		/// matrices with int or long indices to the library -- anything else would run its
+		/// generic, single-threaded routines, so LibRapid's own kernels are used instead.
+		/// \tparam Scalar The scalar type
+		/// \tparam Index The index type
+		template<typename Scalar, typename Index>
+		constexpr bool isSparseBlasType =
+		  (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) &&
+		  (std::is_same_v<Index, int> || std::is_same_v<Index, long>);
+
+		/// Returns the number of threads to use for a sparse operation
+		/// \param work The number of multiply-adds in the operation
+		/// \param rows The number of rows in the sparse matrix
+		/// \return The number of threads to use
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t sparseThreads(int64_t work,
+																		int64_t rows) {
+			if (global::numThreads < 2 || work < global::multithreadThreshold) return 1;
+			return std::max<int64_t>(std::min<int64_t>(global::numThreads, rows), 1);
+		}
+
+		/// Compute rows [begin, end) of y = A * x for a CSR matrix A
+		/// \tparam Scalar The scalar type
+		/// \tparam Index The index type
+		/// \param rowOffsets The row offsets of A
+		/// \param columns The column indices of A
+		/// \param values The nonzero values of A
+		/// \param x The dense vector x
+		/// \param y The dense vector y
+		/// \param begin The first row to compute
+		/// \param end One past the last row to compute
+		template<typename Scalar, typename Index>
+		LIBRAPID_ALWAYS_INLINE void spmvRows(const Index *rowOffsets, const Index *columns,
+											 const Scalar *values, const Scalar *x, Scalar *y,
+											 int64_t begin, int64_t end) {
+			for (int64_t row = begin; row < end; ++row) {
+				Scalar sum(0);
+				for (Index i = rowOffsets[row]; i < rowOffsets[row + 1]; ++i) {
+					sum += values[i] * x[columns[i]];
+				}
+				y[row] = sum;
+			}
+		}
+
+		/// Compute rows [begin, end) of C = A * B for a CSR matrix A and row-major dense matrices
+		/// B and C with \p n columns. Each nonzero element of A scales a contiguous row of B,
+		/// which is accumulated into the row of C with Packets.
+		/// \tparam Scalar The scalar type
+		/// \tparam Index The index type
+		/// \param rowOffsets The row offsets of A
+		/// \param columns The column indices of A
+		/// \param values The nonzero values of A
+		/// \param n The number of columns in B and C
+		/// \param b The dense matrix B
+		/// \param ldb The distance between consecutive rows of B
+		/// \param c The dense matrix C
+		/// \param ldc The distance between consecutive rows of C
+		/// \param begin The first row to compute
+		/// \param end One past the last row to compute
+		template<typename Scalar, typename Index>
+		void spmmRows(const Index *rowOffsets, const Index *columns, const Scalar *values,
+					  int64_t n, const Scalar *b, int64_t ldb, Scalar *c, int64_t ldc,
+					  int64_t begin, int64_t end) {
+			using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+			for (int64_t row = begin; row < end; ++row) {
+				Scalar *cRow = c + row * ldc;
+				std::fill(cRow, cRow + n, Scalar(0));
+
+				for (Index i = rowOffsets[row]; i < rowOffsets[row + 1]; ++i) {
+					const Scalar value = values[i];
+					const Scalar *bRow = b + static_cast<int64_t>(columns[i]) * ldb;
+
+					int64_t col = 0;
+					if constexpr (packetWidth > 1) {
+						const Packet scale(value);
+						for (; col + packetWidth <= n; col += packetWidth) {
+							Packet bVals, cVals;
+							bVals.load(bRow + col);
+							cVals.load(cRow + col);
+							cVals += scale * bVals;
+							cVals.store(cRow + col);
+						}
+					}
+					for (; col < n; ++col) { cRow[col] += value * bRow[col]; }
+				}
+			}
+		}
+
+		/// Sparse matrix-vector product, y = A * x. The rows of A are split between threads by
+		/// their number of nonzero elements (see partitionSparseRows). If a sparse BLAS library
+		/// is available and supports the types (see isSparseBlasType), the product is computed
+		/// by cxxblas::gecrsmv instead.
+		/// \tparam Scalar The scalar type
+		/// \tparam Index The index type
+		/// \param a The sparse matrix A
+		/// \param x The dense vector x (a.cols() elements)
+		/// \param y The dense vector y (a.rows() elements)
+		template<typename Scalar, typename Index>
+		void spmv(const SparseArray<Scalar, Index> &a, const Scalar *x, Scalar *y) {
+			const int64_t rows	 = a.rows();
+			const Index *offsets = a.rowOffsets().data();
+			const Index *columns = a.columnIndices().data();
+			const Scalar *values = a.values().data();
+
+#if defined(HAVE_SPARSEBLAS)
+			if constexpr (isSparseBlasType<Scalar, Index>) {
+				cxxblas::gecrsmv(cxxblas::NoTrans,
+								 static_cast<Index>(rows),
+								 static_cast<Index>(a.cols()),
+								 Scalar(1),
+								 values,
+								 offsets,
+								 columns,
+								 x,
+								 Scalar(0),
+								 y);
+				return;
+			}
+#endif // HAVE_SPARSEBLAS
+
+			const int64_t threads = sparseThreads(a.nnz(), rows);
+			if (threads == 1) {
+				spmvRows(offsets, columns, values, x, y, 0, rows);
+				return;
+			}
+
+			const auto bounds = partitionSparseRows(offsets, rows, threads);
+
+#pragma omp parallel for shared(threads, bounds, offsets, columns, values, x, y) default(none)     \
+  num_threads(threads) schedule(static, 1)
+			for (int64_t part = 0; part < threads; ++part) {
+				spmvRows(offsets, columns, values, x, y, bounds[part], bounds[part + 1]);
+			}
+		}
+
+		/// Sparse matrix-dense matrix product, C = A * B, for row-major B and C. The rows of A
+		/// are split between threads by their number of nonzero elements (see
+		/// partitionSparseRows). If a sparse BLAS library is available and supports the types
+		/// (see isSparseBlasType), the product is computed by cxxblas::gecrsmm instead.
+		/// \tparam Scalar The scalar type
+		/// \tparam Index The index type
+		/// \param a The sparse matrix A
+		/// \param n The number of columns in B and C
+		/// \param b The dense matrix B (a.cols() rows)
+		/// \param ldb The distance between consecutive rows of B
+		/// \param c The dense matrix C (a.rows() rows)
+		/// \param ldc The distance between consecutive rows of C
+		template<typename Scalar, typename Index>
+		void spmm(const SparseArray<Scalar, Index> &a, int64_t n, const Scalar *b, int64_t ldb,
+				  Scalar *c, int64_t ldc) {
+			const int64_t rows	 = a.rows();
+			const Index *offsets = a.rowOffsets().data();
+			const Index *columns = a.columnIndices().data();
+			const Scalar *values = a.values().data();
+
+#if defined(HAVE_SPARSEBLAS)
+			if constexpr (isSparseBlasType<Scalar, Index>) {
+				cxxblas::gecrsmm(cxxblas::NoTrans,
+								 static_cast<Index>(rows),
+								 static_cast<Index>(n),
+								 static_cast<Index>(a.cols()),
+								 Scalar(1),
+								 values,
+								 offsets,
+								 columns,
+								 b,
+								 static_cast<Index>(ldb),
+								 Scalar(0),
+								 c,
+								 static_cast<Index>(ldc));
+				return;
+			}
+#endif // HAVE_SPARSEBLAS
+
+			const int64_t threads = sparseThreads(a.nnz() * n, rows);
+			if (threads == 1) {
+				spmmRows(offsets, columns, values, n, b, ldb, c, ldc, 0, rows);
+				return;
+			}
+
+			const auto bounds = partitionSparseRows(offsets, rows, threads);
+
+#pragma omp parallel for shared(threads, bounds, offsets, columns, values, n, b, ldb, c, ldc)      \
+  default(none) num_threads(threads) schedule(static, 1)
+			for (int64_t part = 0; part < threads; ++part) {
+				spmmRows(
+				  offsets, columns, values, n, b, ldb, c, ldc, bounds[part], bounds[part + 1]);
+			}
+		}
+	} // namespace detail
+
+	/// Multiply a sparse matrix by a dense vector or matrix. A one-dimensional right operand
+	/// gives a matrix-vector product (SpMV), and a two-dimensional one a matrix-matrix product
+	/// (SpMM). Unlike dense matrix multiplication, the product is evaluated immediately.
+	/// \tparam Scalar The scalar type of the sparse matrix
+	/// \tparam Index The index type of the sparse matrix
+	/// \tparam RHS The type of the dense operand
+	/// \param lhs The sparse matrix
+	/// \param rhs The dense vector or matrix
+	/// \return The dense product
+	template<typename Scalar, typename Index, typename RHS>
+	LIBRAPID_NODISCARD auto matmul(const SparseArray<Scalar, Index> &lhs, const RHS &rhs)
+	  -> Array<Scalar> {
+		using RhsType = std::decay_t<RHS>;
+		static_assert(std::is_same_v<typename typetraits::TypeInfo<RhsType>::Scalar, Scalar>,
+					  "Sparse matmul operands must have the same scalar type");
+
+		if constexpr (typetraits::TypeInfo<RhsType>::type != detail::LibRapidType::ArrayContainer) {
+			return matmul(lhs, detail::evalTemporary(rhs));
+		} else {
+			const auto rhsShape = rhs.shape();
+			LIBRAPID_ASSERT(rhsShape.ndim() == 1 || rhsShape.ndim() == 2,
+							"Sparse matmul requires a vector or matrix right operand");
+			LIBRAPID_ASSERT(static_cast<int64_t>(rhsShape[0]) == lhs.cols(),
+							"Cannot multiply a {}x{} matrix by an operand with {} rows",
+							lhs.rows(),
+							lhs.cols(),
+							rhsShape[0]);
+
+			const Scalar *rhsData = rhs.storage().begin();
+			if (rhsShape.ndim() == 1) {
+				Array<Scalar> res(typename Array<Scalar>::ShapeType({size_t(lhs.rows())}));
+				detail::spmv(lhs, rhsData, res.storage().begin());
+				return res;
+			}
+
+			const int64_t n = static_cast<int64_t>(rhsShape[1]);
+			Array<Scalar> res(typename Array<Scalar>::ShapeType({size_t(lhs.rows()), size_t(n)}));
+			detail::spmm(lhs, n, rhsData, n, res.storage().begin(), n);
+			return res;
+		}
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SPARSE_SPARSE_MULTIPLY_HPP
@@ -23,7 +23,7 @@ namespace librapid {
 		};
 	} // namespace typetraits
 
-	template<typename Scalar_, typename Allocator_ = std::allocator<Scalar_>>
+	template<typename Scalar_, typename Allocator_ = AlignedAllocator<Scalar_>>
 	class Storage {
 	public:
 		using Allocator			   = Allocator_;
@@ -284,7 +284,7 @@ namespace librapid {
 		// Scalar *__restrict m_begin							= nullptr;
 		// Scalar *__restrict m_end							= nullptr;
 
-		Scalar m_data[Size];
+		alignas(LIBRAPID_MEM_ALIGN) Scalar m_data[Size];
 	};
 
 	// Trait implementations
@@ -367,6 +367,18 @@ namespace librapid {
 	Storage<T, A>::Storage(SizeType size, ConstReference value, const Allocator &alloc) :
 			m_allocator(alloc), m_begin(detail::safeAllocate(m_allocator, size)),
 			m_end(m_begin + size), m_independent(true) {
+#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+		// Fill large buffers with the same static partition used by detail::assignParallel,
+		// so each page is first touched by the thread which will later work on it
+		const auto elements = static_cast<int64_t>(size);
+		if (elements > global::multithreadThreshold && global::numThreads > 1) {
+			Pointer data = m_begin;
+#	pragma omp parallel for shared(elements, data, value) default(none)                           \
+	  num_threads(global::numThreads)
+			for (int64_t i = 0; i < elements; ++i) { data[i] = value; }
+			return;
+		}
+#endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
 		std::fill(m_begin, m_end, value);
 	}
 
@@ -0,0 +1,203 @@
+#ifndef LIBRAPID_ARRAY_STREAMING_HPP
+#define LIBRAPID_ARRAY_STREAMING_HPP
+
+/*
+ * Out-of-core evaluation. Expressions over file-backed arrays (see mapArray() and loadArray())
+ * can be far larger than memory. assignStreaming() evaluates them in chunks -- while one chunk
+ * is evaluated, the next is read from disk in the background, and once a chunk is finished its
+ * pages are released. At most two chunks of each array are resident at any time, so peak
+ * memory use is set by the chunk budget rather than the size of the arrays.
+ */
+
+namespace librapid {
+	namespace detail {
+		/// An array read element-for-element by an expression, so the part of it used by a
+		/// chunk of the result is contiguous
+		struct StreamSource {
+			const char *data;	 // The first element
+			size_t elementBytes; // The size of each element, in bytes
+		};
+
+		/// Collect the arrays an expression reads element-for-element. Scalars, broadcast
+		/// arrays and non-trivial expressions (such as transposes) are not streamed.
+		/// \tparam T The type of the expression
+		/// \param shape The shape of the result
+		/// \param sources The list to add the arrays to
+		template<typename T>
+		void collectStreamSources(const T &, const Shape<size_t, 32> &,
+								  std::vector<StreamSource> &) {}
+
+		template<typename ShapeType, typename StorageScalar, typename StorageAllocator>
+		void collectStreamSources(
+		  const array::ArrayContainer<ShapeType, Storage<StorageScalar, StorageAllocator>> &array,
+		  const Shape<size_t, 32> &shape, std::vector<StreamSource> &sources) {
+			if (!(array.shape() == shape)) return;
+			const auto *data = reinterpret_cast<const char *>(array.storage().begin());
+			sources.push_back({data, sizeof(StorageScalar)});
+		}
+
+		template<typename Functor_, typename... Args>
+		void
+		collectStreamSources(const Function<descriptor::Trivial, Functor_, Args...> &function,
+							 const Shape<size_t, 32> &shape, std::vector<StreamSource> &sources) {
+			if (!(function.shape() == shape)) return;
+			std::apply(
+			  [&](const auto &...args) { (collectStreamSources(args, shape, sources), ...); },
+			  function.args());
+		}
+
+		/// Read one byte from each page of a range, so every page is resident when the range
+		/// is next used
+		/// \param data The start of the range
+		/// \param bytes The length of the range, in bytes
+		inline void touchPages(const char *data, size_t bytes) {
+			constexpr size_t pageBytes = 4096;
+			const volatile char *pages = data;
+			for (size_t offset = 0; offset < bytes; offset += pageBytes) (void)pages[offset];
+		}
+
+		/// Evaluate the elements [begin, end) of an expression into \p dst, in cache-sized tiles
+		/// \tparam Scalar The scalar type of the result
+		/// \tparam Functor_ The function type
+		/// \tparam Args The argument types of the function
+		/// \param dst The first element of the result
+		/// \param function The expression to evaluate
+		/// \param begin The first index to evaluate
+		/// \param end One past the last index to evaluate
+		template<typename Scalar, typename Functor_, typename... Args>
+		void assignStreamingChunk(Scalar *dst,
+								  const Function<descriptor::Trivial, Functor_, Args...> &function,
+								  int64_t begin, int64_t end) {
+			constexpr bool allowVectorisation = typetraits::TypeInfo<
+			  Function<descriptor::Trivial, Functor_, Args...>>::allowVectorisation;
+			const bool parallel =
+			  end - begin > global::multithreadThreshold && global::numThreads > 1;
+
+			if constexpr (allowVectorisation) {
+				const int64_t tile = tileSize<Scalar>();
+#pragma omp parallel for shared(dst, function, begin, end, tile) default(none)                     \
+  num_threads(global::numThreads) if (parallel)
+				for (int64_t index = begin; index < end; index += tile) {
+					function.evaluateTile(index, std::min(tile, end - index), dst + index);
+				}
+			} else {
+#pragma omp parallel for shared(dst, function, begin, end) default(none)                           \
+  num_threads(global::numThreads) if (parallel)
+				for (int64_t index = begin; index < end; ++index) {
+					dst[index] = function.scalar(index);
+				}
+			}
+		}
+	} // namespace detail
+
+	/// Evaluate an expression into an array one chunk at a time, for expressions over
+	/// file-backed arrays which are too large to fit in memory. Each chunk of the arrays the
+	/// expression reads is prefetched in the background while the previous chunk is evaluated,
+	/// and released once it has been used. Only arrays which are file-backed (and not mapped
+	/// with MmapMode::CopyOnWrite) are released -- the result should be mapped with
+	/// MmapMode::ReadWrite if it is too large for memory as well (see evaluateToFile()).
+	/// \tparam ShapeType_ The shape type of the array container
+	/// \tparam StorageScalar The scalar type of the storage object
+	/// \tparam StorageAllocator The Allocator of the Storage object
+	/// \tparam Functor_ The function type
+	/// \tparam Args The argument types of the function
+	/// \param dst The array to assign to
+	/// \param function The expression to evaluate
+	/// \param chunkBudget The approximate number of bytes of the arrays which are resident at
+	/// once
+	template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+			 typename Functor_, typename... Args>
+	void assignStreaming(
+	  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &dst,
+	  const detail::Function<detail::descriptor::Trivial, Functor_, Args...> &function,
+	  int64_t chunkBudget = global::streamingChunkBudget) {
+		using Scalar = StorageScalar;
+		static_assert(typetraits::IsSame<Scalar, typename std::decay_t<decltype(function)>::Scalar>,
+					  "Function return type must be the same as the array container's scalar type");
+		LIBRAPID_ASSERT(dst.shape() == function.shape(), "Shapes must be equal");
+
+		const auto shape   = function.shape();
+		const int64_t size = shape.size();
+		Scalar *out		   = dst.storage().begin();
+
+		std::vector<detail::StreamSource> sources;
+		detail::collectStreamSources(function, shape, sources);
+		int64_t elementBytes = sizeof(Scalar);
+		for (const auto &source : sources) elementBytes += source.elementBytes;
+
+		// The chunk being evaluated and the chunk being prefetched must both fit in the budget
+		const int64_t tile = detail::tileSize<Scalar>();
+		int64_t chunk	   = chunkBudget / (2 * elementBytes);
+		chunk			   = std::max(chunk - chunk % tile, tile);
+
+		auto prefetch = [&sources, size, chunk](int64_t begin) {
+			const int64_t length = std::min(chunk, size - begin);
+			for (const auto &source : sources) {
+				detail::prefetchMappedRange(source.data + begin * source.elementBytes,
+											length * source.elementBytes);
+			}
+			return std::async(std::launch::async, [&sources, begin, length]() {
+				for (const auto &source : sources) {
+					detail::touchPages(source.data + begin * source.elementBytes,
+									   length * source.elementBytes);
+				}
+			});
+		};
+
+		std::future<void> next;
+		if (!sources.empty() && size > 0) next = prefetch(0);
+
+		for (int64_t begin = 0; begin < size; begin += chunk) {
+			const int64_t end = std::min(begin + chunk, size);
+			if (next.valid()) next.get();
+			if (!sources.empty() && end < size) next = prefetch(end);
+
+			detail::assignStreamingChunk(out, function, begin, end);
+
+			for (const auto &source : sources) {
+				detail::releaseMappedRange(source.data + begin * source.elementBytes,
+										   (end - begin) * source.elementBytes);
+			}
+			detail::releaseMappedRange(out + begin, (end - begin) * sizeof(Scalar));
+		}
+	}
+
+	/// Evaluate an expression straight into a new file with assignStreaming(), so neither the
+	/// arguments nor the result need to fit in memory. The file can be loaded again with
+	/// loadArray().
+	/// \tparam Functor_ The function type
+	/// \tparam Args The argument types of the function
+	/// \param path The path of the file, which is replaced if it exists
+	/// \param function The expression to evaluate
+	/// \param format The format of the file
+	/// \param chunkBudget The approximate number of bytes of the arrays which are resident at
+	/// once
+	/// \return The result, backed by the file
+	template<typename Functor_, typename... Args>
+	LIBRAPID_NODISCARD auto
+	evaluateToFile(const std::string &path,
+				   const detail::Function<detail::descriptor::Trivial, Functor_, Args...> &function,
+				   ArrayFileFormat format = ArrayFileFormat::Auto,
+				   int64_t chunkBudget	  = global::streamingChunkBudget) {
+		using Scalar = typename detail::Function<detail::descriptor::Trivial, Functor_,
+												 Args...>::Scalar;
+
+		const auto shape = function.shape();
+		std::vector<size_t> dims(shape.ndim());
+		for (size_t i = 0; i < dims.size(); ++i) dims[i] = shape[i];
+
+		const std::string header =
+		  detail::encodeArrayFileHeader(detail::npyDescr<Scalar>(),
+										dims,
+										detail::resolveArrayFileFormat(path, format));
+		detail::writeArrayFile(path, header, nullptr, 0);
+
+		// The file is extended to fit the result when it is mapped
+		auto result = mapArray<Scalar>(
+		  path, shape, MmapMode::ReadWrite, MmapAdvice::Sequential, header.size());
+		assignStreaming(result, function, chunkBudget);
+		return result;
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_STREAMING_HPP
@@ -36,6 +36,14 @@ namespace librapid {
 		/// Move a Stride object to this Stride object.
 		/// \param other The Stride object to move.
 		Stride &operator=(Stride &&other) noexcept = default;
+
+		/// Return a sub-stride of this Stride object. Unlike Shape::subshape, the strides are
+		/// copied directly instead of being recomputed from the dimensions, so a sub-stride of a
+		/// non-contiguous Stride is still valid.
+		/// \param start Starting index
+		/// \param end Ending index
+		/// \return Sub-stride
+		LIBRAPID_NODISCARD Stride subshape(size_t start, size_t end) const;
 	};
 
 	template<typename T, size_t N>
@@ -51,6 +59,18 @@ namespace librapid {
 		for (size_t i = this->m_dims - 1; i > 0; --i) tmp[i - 1] = tmp[i] * this->m_data[i];
 		for (size_t i = 0; i < this->m_dims; ++i) this->m_data[i] = tmp[i];
 	}
+
+	template<typename T, size_t N>
+	auto Stride<T, N>::subshape(size_t start, size_t end) const -> Stride {
+		LIBRAPID_ASSERT(start <= end, "Start index must be less than end index");
+		LIBRAPID_ASSERT(end <= this->m_dims,
+						"End index must be less than or equal to the number of dimensions");
+
+		Stride res;
+		res.m_dims = end - start;
+		for (size_t i = 0; i < res.m_dims; ++i) res.m_data[i] = this->m_data[i + start];
+		return res;
+	}
 } // namespace librapid
 
 // Support FMT printing
@@ -2,7 +2,530 @@
 #define LIBRAPID_ARRAY_TRANSPOSE_HPP
 
 namespace librapid {
-	
-}
+	namespace detail {
+		/// Functor for an array transposition. The data movement is handled by the Transpose
+		/// Function and its assignment operators, so the functor itself only stores the axis
+		/// permutation -- element-wise, a transposition is the identity.
+		struct Transpose {
+			Transpose() = default;
 
-#endif // LIBRAPID_ARRAY_TRANSPOSE_HPP
\ No newline at end of file
+			/// Construct a Transpose functor from a permutation of the axes
+			/// \param axes_ The permutation of the axes
+			explicit Transpose(const Shape<size_t, 32> &axes_) : axes(axes_) {}
+
+			template<typename T>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &val) const {
+				return val;
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &val) const {
+				return val;
+			}
+
+			Shape<size_t, 32> axes; /// Output dimension i is input dimension axes[i]
+		};
+	} // namespace detail
+
+	namespace typetraits {
+		template<>
+		struct TypeInfo<::librapid::detail::Transpose> {
+			static constexpr const char *name = "transpose";
+		};
+	} // namespace typetraits
+
+	namespace detail {
+		/// A lazily-evaluated transposition (axis permutation) of an array or expression.
+		/// Element-wise access is supported, so the result can be indexed and printed, but
+		/// assigning it to an array uses a dedicated, cache-blocked kernel (see assign).
+		/// \tparam Functor_ The functor type (Transpose)
+		/// \tparam Arg The type of the array being transposed
+		template<typename Functor_, typename Arg>
+		class Function<descriptor::Transpose, Functor_, Arg> {
+		public:
+			using Type		 = Function<descriptor::Transpose, Functor_, Arg>;
+			using Functor	 = Functor_;
+			using ShapeType	 = Shape<size_t, 32>;
+			using StrideType = ShapeType;
+			using Scalar	 = typename typetraits::TypeInfo<Type>::Scalar;
+			using Device	 = typename typetraits::TypeInfo<Type>::Device;
+			using Packet	 = typename typetraits::TypeInfo<Scalar>::Packet;
+
+			using Descriptor = descriptor::Transpose;
+
+			Function() = default;
+
+			/// Constructs a transposition of \p arg, permuting its axes as described by the
+			/// functor
+			/// \param functor The Transpose functor
+			/// \param arg The array to transpose
+			LIBRAPID_ALWAYS_INLINE explicit Function(Functor &&functor, Arg &&arg);
+
+			LIBRAPID_ALWAYS_INLINE Function(const Function &other)				= default;
+			LIBRAPID_ALWAYS_INLINE Function(Function &&other) noexcept			= default;
+			LIBRAPID_ALWAYS_INLINE Function &operator=(const Function &other)	= default;
+			LIBRAPID_ALWAYS_INLINE Function &operator=(Function &&other) noexcept = default;
+
+			/// Return the shape of the transposed array
+			/// \return The shape of the result
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto shape() const;
+
+			/// Return the arguments in the Function (the array being transposed)
+			/// \return The arguments in the Function
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto &args() const;
+
+			/// Return the permutation of the axes
+			/// \return Output dimension i is input dimension axes()[i]
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const ShapeType &axes() const;
+
+			/// Return an evaluated Array object
+			/// \return The transposed array
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto eval() const;
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator[](int64_t index) const;
+
+			/// Evaluates the transposition at the given index, returning a Packet result. The
+			/// elements are not contiguous in the source, so they are read one at a time.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (vectorized).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
+
+			/// Evaluates the transposition at the given index, returning a Scalar result.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (scalar).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalar(size_t index) const;
+
+			/// Return a string representation of the Function
+			/// \param format The format to use.
+			/// \return A string representation of the Function
+			LIBRAPID_NODISCARD std::string str(const std::string &format = "{}") const;
+
+		private:
+			Functor m_functor;
+			std::tuple<Arg> m_args;
+			ShapeType m_shape;
+			StrideType m_srcStride; // Stride of the argument along each output dimension
+		};
+
+		template<typename Functor, typename Arg>
+		Function<descriptor::Transpose, Functor, Arg>::Function(Functor &&functor, Arg &&arg) :
+				m_functor(std::forward<Functor>(functor)), m_args(std::forward<Arg>(arg)) {
+			const auto srcShape	 = ShapeType(std::get<0>(m_args).shape());
+			const auto srcStride = Stride<size_t, 32>(srcShape);
+			const auto ndim		 = static_cast<int64_t>(srcShape.ndim());
+			const auto &axes	 = m_functor.axes;
+
+			LIBRAPID_ASSERT(static_cast<int64_t>(axes.ndim()) == ndim,
+							"Transpose axes {} do not match an array with {} dimensions",
+							axes.str(),
+							ndim);
+
+			m_shape		= ShapeType::zeros(ndim);
+			m_srcStride = StrideType::zeros(ndim);
+			std::array<bool, 32> used {};
+			for (int64_t i = 0; i < ndim; ++i) {
+				LIBRAPID_ASSERT(static_cast<int64_t>(axes[i]) < ndim && !used[axes[i]],
+								"Transpose axes {} are not a permutation",
+								axes.str());
+				used[axes[i]]  = true;
+				m_shape[i]	   = srcShape[axes[i]];
+				m_srcStride[i] = srcStride[axes[i]];
+			}
+		}
+
+		template<typename Functor, typename Arg>
+		auto Function<descriptor::Transpose, Functor, Arg>::shape() const {
+			return m_shape;
+		}
+
+		template<typename Functor, typename Arg>
+		auto &Function<descriptor::Transpose, Functor, Arg>::args() const {
+			return m_args;
+		}
+
+		template<typename Functor, typename Arg>
+		auto Function<descriptor::Transpose, Functor, Arg>::axes() const -> const ShapeType & {
+			return m_functor.axes;
+		}
+
+		template<typename Functor, typename Arg>
+		auto Function<descriptor::Transpose, Functor, Arg>::eval() const {
+			Array<Scalar, Device> res(shape());
+			res = *this;
+			return res;
+		}
+
+		template<typename Functor, typename Arg>
+		auto Function<descriptor::Transpose, Functor, Arg>::operator[](int64_t index) const {
+			return array::ArrayView(*this)[index];
+		}
+
+		template<typename Functor, typename Arg>
+		auto Function<descriptor::Transpose, Functor, Arg>::packet(size_t index) const
+		  -> Packet {
+			constexpr auto width = static_cast<int64_t>(Packet::size());
+			Packet res;
+			for (int64_t i = 0; i < width; ++i) { res[i] = scalar(index + i); }
+			return res;
+		}
+
+		template<typename Functor, typename Arg>
+		auto Function<descriptor::Transpose, Functor, Arg>::scalar(size_t index) const
+		  -> Scalar {
+			size_t srcIndex = 0;
+			for (int64_t i = static_cast<int64_t>(m_shape.ndim()) - 1; i >= 0; --i) {
+				srcIndex += (index % m_shape[i]) * m_srcStride[i];
+				index /= m_shape[i];
+			}
+			return m_functor(std::get<0>(m_args).scalar(srcIndex));
+		}
+
+		template<typename Functor, typename Arg>
+		std::string
+		Function<descriptor::Transpose, Functor, Arg>::str(const std::string &format) const {
+			return array::ArrayView(*this).str(format);
+		}
+
+		/// Return the side length of the square tiles used to transpose an array. Each tile of
+		/// the source and destination fits in half of the L1 cache, and the side length is a
+		/// multiple of the cache line and packet widths so tiles start on whole cache lines.
+		/// \tparam Scalar The scalar type of the array
+		/// \return The side length of each tile
+		template<typename Scalar>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t transposeTileSize() {
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+			constexpr int64_t scalarBytes = sizeof(Scalar);
+			const int64_t lineElements	  = global::cacheLineSize / scalarBytes;
+			const int64_t alignment		  = std::max({packetWidth, lineElements, int64_t(1)});
+
+			auto side = static_cast<int64_t>(
+			  std::sqrt(static_cast<double>(global::l1CacheSize) / (4 * scalarBytes)));
+			side = std::min(side, int64_t(256));
+			return std::max(side - (side % alignment), alignment);
+		}
+
+		/// Transpose a square block of Packet::size() x Packet::size() elements in registers.
+		/// Each round interleaves row i with row i + width / 2, and after log2(width) rounds
+		/// the rows hold the columns of the original block.
+		/// \tparam Packet The packet type
+		/// \tparam Scalar The scalar type
+		/// \param src The first element of the source block
+		/// \param dst The first element of the destination block
+		/// \param srcLd The distance between consecutive rows of the source
+		/// \param dstLd The distance between consecutive rows of the destination
+		template<typename Packet, typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void transposePacketBlock(const Scalar *src, Scalar *dst,
+														 int64_t srcLd, int64_t dstLd) {
+			constexpr int64_t width = Packet::size();
+			Packet rows[width];
+			Packet tmp[width];
+
+			for (int64_t i = 0; i < width; ++i) { rows[i].load(src + i * srcLd); }
+
+			for (int64_t round = 1; round < width; round *= 2) {
+				for (int64_t i = 0; i < width / 2; ++i) {
+					tmp[2 * i]	   = rows[i].interleaveLow(rows[i + width / 2]);
+					tmp[2 * i + 1] = rows[i].interleaveHigh(rows[i + width / 2]);
+				}
+				for (int64_t i = 0; i < width; ++i) { rows[i] = tmp[i]; }
+			}
+
+			for (int64_t i = 0; i < width; ++i) { rows[i].store(dst + i * dstLd); }
+		}
+
+		/// Transpose a single tile, such that dst[r * dstLd + c] = src[c * srcLd + r]. Full
+		/// blocks of packets are transposed in registers, and the edges element by element.
+		/// \tparam Scalar The scalar type
+		/// \param src The first element of the source tile
+		/// \param dst The first element of the destination tile
+		/// \param rows The number of rows in the destination tile
+		/// \param cols The number of columns in the destination tile
+		/// \param srcLd The distance between consecutive rows of the source
+		/// \param dstLd The distance between consecutive rows of the destination
+		template<typename Scalar>
+		LIBRAPID_ALWAYS_INLINE void transposeTile(const Scalar *src, Scalar *dst, int64_t rows,
+												  int64_t cols, int64_t srcLd, int64_t dstLd) {
+			using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+			constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+			int64_t r = 0;
+
+			// Larger blocks would spill the registers, so wider packets are transposed by element
+			if constexpr (packetWidth > 1 && packetWidth <= 8) {
+				for (; r + packetWidth <= rows; r += packetWidth) {
+					int64_t c = 0;
+					for (; c + packetWidth <= cols; c += packetWidth) {
+						transposePacketBlock<Packet>(
+						  src + c * srcLd + r, dst + r * dstLd + c, srcLd, dstLd);
+					}
+
+					for (; c < cols; ++c) {
+						for (int64_t i = r; i < r + packetWidth; ++i) {
+							dst[i * dstLd + c] = src[c * srcLd + i];
+						}
+					}
+				}
+			}
+
+			for (; r < rows; ++r) {
+				for (int64_t c = 0; c < cols; ++c) { dst[r * dstLd + c] = src[c * srcLd + r]; }
+			}
+		}
+
+		/// Describes how an axis permutation is split into independent copies. If the innermost
+		/// dimension is unchanged, each row of the result is a contiguous copy of a row of the
+		/// source. Otherwise, the output dimension which is contiguous in the source and the
+		/// innermost output dimension form a 2D plane which is transposed tile by tile, and the
+		/// remaining dimensions enumerate the planes ("batches").
+		struct TransposePlan {
+			bool rowCopy;	   // The innermost dimension is unchanged
+			int64_t rows;	   // Rows of each plane (or 1 for a row copy)
+			int64_t cols;	   // Columns of each plane (or the length of each row)
+			int64_t srcLd;	   // Source distance between consecutive columns of a plane
+			int64_t dstLd;	   // Destination distance between consecutive rows of a plane
+			int64_t batches;   // Number of planes (or rows)
+			int64_t batchDims; // Number of dimensions enumerating the batches
+			std::array<int64_t, 32> batchShape;
+			std::array<int64_t, 32> batchSrcStride;
+			std::array<int64_t, 32> batchDstStride;
+
+			/// Compute the offsets of a batch in the source and destination
+			/// \param batch The index of the batch
+			/// \param srcOffset Set to the offset of the batch in the source
+			/// \param dstOffset Set to the offset of the batch in the destination
+			LIBRAPID_ALWAYS_INLINE void offsets(int64_t batch, int64_t &srcOffset,
+												int64_t &dstOffset) const {
+				srcOffset = 0;
+				dstOffset = 0;
+				for (int64_t i = batchDims - 1; i >= 0; --i) {
+					const int64_t coord = batch % batchShape[i];
+					batch /= batchShape[i];
+					srcOffset += coord * batchSrcStride[i];
+					dstOffset += coord * batchDstStride[i];
+				}
+			}
+		};
+
+		/// Construct a TransposePlan for a permutation of a contiguous array
+		/// \param srcShape The shape of the source
+		/// \param axes The permutation of the axes
+		/// \return The TransposePlan
+		LIBRAPID_NODISCARD inline TransposePlan makeTransposePlan(const Shape<size_t, 32> &srcShape,
+																  const Shape<size_t, 32> &axes) {
+			const auto ndim = static_cast<int64_t>(srcShape.ndim());
+			const Stride<size_t, 32> srcStride(srcShape);
+			auto dstShape = Shape<size_t, 32>::zeros(ndim);
+			for (int64_t i = 0; i < ndim; ++i) { dstShape[i] = srcShape[axes[i]]; }
+			const Stride<size_t, 32> dstStride(dstShape);
+
+			// The output dimension which is contiguous in the source
+			int64_t contiguous = ndim - 1;
+			while (contiguous > 0 && static_cast<int64_t>(axes[contiguous]) != ndim - 1) {
+				--contiguous;
+			}
+
+			TransposePlan plan {};
+			plan.rowCopy   = contiguous == ndim - 1;
+			plan.rows	   = plan.rowCopy ? 1 : dstShape[contiguous];
+			plan.cols	   = dstShape[ndim - 1];
+			plan.srcLd	   = srcStride[axes[ndim - 1]];
+			plan.dstLd	   = plan.rowCopy ? 0 : dstStride[contiguous];
+			plan.batches   = 1;
+			plan.batchDims = 0;
+
+			for (int64_t i = 0; i < ndim - 1; ++i) {
+				if (i == contiguous) continue;
+				plan.batchShape[plan.batchDims]		= dstShape[i];
+				plan.batchSrcStride[plan.batchDims] = srcStride[axes[i]];
+				plan.batchDstStride[plan.batchDims] = dstStride[i];
+				plan.batches *= dstShape[i];
+				++plan.batchDims;
+			}
+
+			return plan;
+		}
+
+		/// Write a permutation of the axes of a contiguous array to \p dst. Planes are split into
+		/// square tiles which fit in the L1 cache, so both the reads and writes of each tile
+		/// use every element of the cache lines they touch.
+		/// \tparam Scalar The scalar type
+		/// \param src The source data
+		/// \param dst The destination data
+		/// \param srcShape The shape of the source
+		/// \param axes The permutation of the axes
+		/// \param parallel If true, tiles (or rows) are processed in parallel
+		template<typename Scalar>
+		void transposeData(const Scalar *src, Scalar *dst, const Shape<size_t, 32> &srcShape,
+						   const Shape<size_t, 32> &axes, bool parallel) {
+			if (srcShape.ndim() == 0) {
+				dst[0] = src[0];
+				return;
+			}
+
+			const TransposePlan plan = makeTransposePlan(srcShape, axes);
+
+			if (plan.rowCopy) {
+#pragma omp parallel for shared(src, dst, plan) default(none) num_threads(global::numThreads)     \
+  if (parallel)
+				for (int64_t row = 0; row < plan.batches; ++row) {
+					int64_t srcOffset, dstOffset;
+					plan.offsets(row, srcOffset, dstOffset);
+					std::copy(src + srcOffset, src + srcOffset + plan.cols, dst + dstOffset);
+				}
+				return;
+			}
+
+			const int64_t tile		 = transposeTileSize<Scalar>();
+			const int64_t rowTiles	 = (plan.rows + tile - 1) / tile;
+			const int64_t colTiles	 = (plan.cols + tile - 1) / tile;
+			const int64_t planeTiles = rowTiles * colTiles;
+			const int64_t numTiles	 = plan.batches * planeTiles;
+
+#pragma omp parallel for shared(src, dst, plan, tile, colTiles, planeTiles, numTiles)             \
+  default(none) num_threads(global::numThreads) if (parallel)
+			for (int64_t i = 0; i < numTiles; ++i) {
+				int64_t srcOffset, dstOffset;
+				plan.offsets(i / planeTiles, srcOffset, dstOffset);
+
+				const int64_t r = ((i % planeTiles) / colTiles) * tile;
+				const int64_t c = ((i % planeTiles) % colTiles) * tile;
+				transposeTile(src + srcOffset + c * plan.srcLd + r,
+							  dst + dstOffset + r * plan.dstLd + c,
+							  std::min(tile, plan.rows - r),
+							  std::min(tile, plan.cols - c),
+							  plan.srcLd,
+							  plan.dstLd);
+			}
+		}
+
+		/// Evaluate a transposition into \p dst. Arrays are read in place, while views and
+		/// expressions are first evaluated into a contiguous temporary.
+		/// \tparam Scalar The scalar type of the result
+		/// \tparam Functor_ The functor type (Transpose)
+		/// \tparam Arg The type of the array being transposed
+		/// \param dst The memory to write the result to
+		/// \param function The transposition to evaluate
+		/// \param parallel If true, the transposition is done in parallel
+		template<typename Scalar, typename Functor_, typename Arg>
+		LIBRAPID_ALWAYS_INLINE void
+		assignTranspose(Scalar *dst, const Function<descriptor::Transpose, Functor_, Arg> &function,
+						bool parallel) {
+			using ArgType	   = std::decay_t<Arg>;
+			using FunctionType = Function<descriptor::Transpose, Functor_, Arg>;
+			static_assert(std::is_same_v<Scalar, typename FunctionType::Scalar>,
+						  "Function return type must be the same as the array's scalar type");
+
+			const auto &arg = std::get<0>(function.args());
+			const Shape<size_t, 32> srcShape(arg.shape());
+
+			if constexpr (typetraits::typetraits::IsArrayContainer<ArgType>::value) {
+				transposeData<Scalar>(
+				  arg.storage().begin(), dst, srcShape, function.axes(), parallel);
+			} else {
+				const auto evaluated = evalTemporary(arg);
+				transposeData<Scalar>(
+				  evaluated.storage().begin(), dst, srcShape, function.axes(), parallel);
+			}
+		}
+
+		/// Transpose assignment -- the array is transposed tile by tile (see transposeData). If
+		/// the transposition reads from \p lhs (as in a = transpose(a)), it is evaluated into a
+		/// temporary first.
+		/// \tparam ShapeType_ The shape type of the array container
+		/// \tparam StorageScalar The scalar type of the storage object
+		/// \tparam StorageAllocator The Allocator of the Storage object
+		/// \tparam Functor_ The functor type (Transpose)
+		/// \tparam Args The argument types of the function
+		/// \param lhs The array container to assign to
+		/// \param function The transposition to assign
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+			   const detail::Function<descriptor::Transpose, Functor_, Args...> &function) {
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+			if (mayAlias(function, storageRange(lhs.storage()))) {
+				lhs = std::decay_t<decltype(lhs)>(function);
+				return;
+			}
+			assignTranspose(lhs.storage().begin(), function, false);
+		}
+
+		/// Transpose assignment with fixed-size arrays
+		/// \see assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>>
+		/// &lhs, const detail::Function<descriptor::Transpose, Functor_, Args...> &function)
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+			   const detail::Function<descriptor::Transpose, Functor_, Args...> &function) {
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+			if (mayAlias(function, storageRange(lhs.storage()))) {
+				lhs = std::decay_t<decltype(lhs)>(function);
+				return;
+			}
+			assignTranspose(lhs.storage().begin(), function, false);
+		}
+
+		/// Transpose assignment with parallel execution. Tiles are distributed between threads.
+		/// \see assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>>
+		/// &lhs, const detail::Function<descriptor::Transpose, Functor_, Args...> &function)
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const detail::Function<descriptor::Transpose, Functor_, Args...> &function) {
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+			if (mayAlias(function, storageRange(lhs.storage()))) {
+				lhs = std::decay_t<decltype(lhs)>(function);
+				return;
+			}
+			assignTranspose(lhs.storage().begin(), function, true);
+		}
+
+		/// Transpose assignment with fixed-size arrays and parallel execution
+		/// \see assignParallel(array::ArrayContainer<ShapeType_, Storage<StorageScalar,
+		/// StorageAllocator>> &lhs, const detail::Function<descriptor::Transpose, Functor_,
+		/// Args...> &function)
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		  const detail::Function<descriptor::Transpose, Functor_, Args...> &function) {
+			LIBRAPID_ASSERT(lhs.shape() == function.shape(), "Shapes must be equal");
+			if (mayAlias(function, storageRange(lhs.storage()))) {
+				lhs = std::decay_t<decltype(lhs)>(function);
+				return;
+			}
+			assignTranspose(lhs.storage().begin(), function, true);
+		}
+	} // namespace detail
+
+	/// Permute the axes of an array, view or expression. The result is evaluated lazily, and
+	/// assigning it to an array uses a cache-blocked kernel which transposes small blocks in
+	/// registers. By default, the order of the axes is reversed, so a matrix is transposed.
+	/// \tparam T The type of the input
+	/// \param array The array to transpose
+	/// \param axes The permutation of the axes. Dimension i of the result is dimension axes[i]
+	/// of the input
+	/// \return A Function object representing the transposition
+	template<typename T,
+			 typename std::enable_if_t<typetraits::TypeInfo<std::decay_t<T>>::type !=
+										 ::librapid::detail::LibRapidType::Scalar,
+									   int> = 0>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+	transpose(T &&array, const Shape<size_t, 32> &axes = Shape<size_t, 32>())
+	  -> detail::Function<detail::descriptor::Transpose, detail::Transpose, T> {
+		const int64_t ndim			  = array.shape().ndim();
+		Shape<size_t, 32> permutation = axes;
+		if (axes.ndim() == 0 && ndim > 0) {
+			permutation = Shape<size_t, 32>::zeros(ndim);
+			for (int64_t i = 0; i < ndim; ++i) { permutation[i] = ndim - i - 1; }
+		}
+
+		using FunctionType = detail::Function<detail::descriptor::Transpose, detail::Transpose, T>;
+		return FunctionType(detail::Transpose(permutation), std::forward<T>(array));
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_TRANSPOSE_HPP
@@ -238,6 +238,13 @@
 #	define LIBRAPID_MAX_ARRAY_DIMS 32
 #endif // LIBRAPID_MAX_ARRAY_DIMS
 
+// Configuration Option: LIBRAPID_MEM_ALIGN
+// The alignment (in bytes) of the memory allocated for arrays. The default of 64 bytes is a
+// full AVX-512 register and a cache line on most CPUs. Must be a power of two.
+#ifndef LIBRAPID_MEM_ALIGN
+#	define LIBRAPID_MEM_ALIGN 64
+#endif // LIBRAPID_MEM_ALIGN
+
 // Configuration Option: LIBRAPID_OPTIMISE_SMALL_ARRAYS
 // Remove the branch required for dynamic parallelization of
 // loops, making the code faster for smaller arrays, but
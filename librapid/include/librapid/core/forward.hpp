@@ -28,6 +28,16 @@ namespace librapid {
 		template<typename desc, typename Functor_, typename... Args>
 		class Function;
 
+		// Element-wise functors used by the compound assignment operators. These are defined in
+		// "operations.hpp"
+		struct Plus;
+		struct Minus;
+		struct Multiply;
+		struct Divide;
+
+		template<typename desc, typename Functor, typename... Args>
+		auto makeFunction(Args &&...args);
+
 		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
 				 typename Functor_, typename... Args>
 		LIBRAPID_ALWAYS_INLINE void
@@ -52,6 +62,78 @@ namespace librapid {
 		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
 		  const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
 
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+			   const detail::Function<descriptor::Transpose, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+			   const detail::Function<descriptor::Transpose, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const detail::Function<descriptor::Transpose, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		  const detail::Function<descriptor::Transpose, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+			   const detail::Function<descriptor::Matmul, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+			   const detail::Function<descriptor::Matmul, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const detail::Function<descriptor::Matmul, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		  const detail::Function<descriptor::Matmul, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+			   const detail::Function<descriptor::Combined, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+			   const detail::Function<descriptor::Combined, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename StorageAllocator,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, Storage<StorageScalar, StorageAllocator>> &lhs,
+		  const detail::Function<descriptor::Combined, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, size_t... StorageSize,
+				 typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void assignParallel(
+		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
+		  const detail::Function<descriptor::Combined, Functor_, Args...> &function);
+
 #if defined(LIBRAPID_HAS_CUDA)
 		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
 		LIBRAPID_ALWAYS_INLINE void
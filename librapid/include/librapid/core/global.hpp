@@ -6,6 +6,15 @@
  * CUDA-related configuration, etc.
  */
 
+namespace librapid {
+	/// How the memory for large arrays is backed by huge pages (see HugePageAllocator)
+	enum class HugePageMode {
+		None,		 // Use the system allocator
+		Transparent, // Request transparent huge pages with madvise(MADV_HUGEPAGE)
+		Explicit	 // Map explicit huge pages (MAP_HUGETLB), falling back to Transparent
+	};
+} // namespace librapid
+
 namespace librapid::global {
 	// Should ASSERT functions error or throw exceptions?
 	extern bool throwOnAssert;
@@ -13,11 +22,45 @@ namespace librapid::global {
 	/// Arrays with more elements than this will run with multithreaded implementations
 	extern int64_t multithreadThreshold;
 
-	// Number of columns required for a matrix to be parallelized in GEMM
+	/// Matrix multiplications with at least this many rows and columns in the result will run
+	/// with multiple threads
 	extern int64_t gemmMultithreadThreshold;
 
 	// Number of threads used by LibRapid
 	extern int64_t numThreads;
+
+	// Cache sizes (in bytes) used to pick block sizes. Detected before main() is called, but
+	// these can be overridden at any time
+	extern int64_t cacheLineSize;
+	extern int64_t l1CacheSize;
+	extern int64_t l2CacheSize;
+	extern int64_t l3CacheSize;
+
+	/// Expressions reading from at least this many arrays are evaluated in tiles (see
+	/// assignTiled). Derived from the L1 cache size at startup
+	extern int64_t tiledEvaluationThreshold;
+
+	/// The maximum number of bytes of free blocks cached by each thread's memory pool cache,
+	/// and by the shared cache (see CachingAllocator)
+	extern int64_t memoryPoolCacheSize;
+
+	/// Huge pages used for arrays allocated with the default allocator (AlignedAllocator)
+	extern HugePageMode hugePageMode;
+
+	/// Only allocations of at least this many bytes (and at least one huge page) are backed
+	/// by huge pages when hugePageMode is not HugePageMode::None
+	extern int64_t hugePageThreshold;
+
+	/// The approximate number of bytes of the arrays used by an expression which are resident
+	/// at once when it is evaluated with assignStreaming()
+	extern int64_t streamingChunkBudget;
+
+	/// Arrays with more than this many elements are summarised when they are printed, showing
+	/// only the first and last printEdgeItems indices along each dimension
+	extern int64_t printThreshold;
+
+	/// The number of indices printed at each end of a dimension of a summarised array
+	extern int64_t printEdgeItems;
 } // namespace librapid::global
 
 #endif // LIBRAPID_CORE_GLOBAL_HPP
\ No newline at end of file
@@ -13,21 +13,26 @@
 #include <array>
 #include <atomic>
 #include <cfloat>
+#include <charconv>
 #include <chrono>
 #include <cmath>
 #include <complex>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <cfloat>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <new>
 #include <random>
+#include <tuple>
 #include <utility>
 
 #if defined(LIBRAPID_HAS_OMP)
@@ -90,6 +90,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = T;
 			using Packet							   = std::false_type;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = 1;
 			static constexpr char name[]			   = "[NO DEFINED TYPE]";
@@ -119,6 +120,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = bool;
 			using Packet							   = std::false_type;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = 1;
 			static constexpr char name[]			   = "char";
@@ -140,6 +142,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = char;
 			using Packet							   = std::false_type;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = 1;
 			static constexpr char name[]			   = "bool";
@@ -170,6 +173,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = int8_t;
 			using Packet							   = Vc::Vector<int8_t>;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "int8_t";
@@ -200,6 +204,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = uint8_t;
 			using Packet							   = Vc::Vector<uint8_t>;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "uint8_t";
@@ -230,6 +235,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = int16_t;
 			using Packet							   = Vc::Vector<int16_t>;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "int16_t";
@@ -260,6 +266,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = uint16_t;
 			using Packet							   = Vc::Vector<uint16_t>;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "uint16_t";
@@ -290,6 +297,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = int32_t;
 			using Packet							   = Vc::Vector<int32_t>;
+			using PacketPromotions					   = std::tuple<int16_t, uint16_t>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "int32_t";
@@ -320,6 +328,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = uint32_t;
 			using Packet							   = Vc::Vector<uint32_t>;
+			using PacketPromotions					   = std::tuple<uint16_t>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "uint32_t";
@@ -350,6 +359,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = int64_t;
 			using Packet							   = std::false_type;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = 1;
 			static constexpr char name[]			   = "int64_t";
@@ -380,6 +390,7 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = uint64_t;
 			using Packet							   = std::false_type;
+			using PacketPromotions					   = std::tuple<>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = 1;
 			static constexpr char name[]			   = "uint64_t";
@@ -410,6 +421,8 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = float;
 			using Packet							   = Vc::Vector<float>;
+			using PacketPromotions					   =
+			  std::tuple<int32_t, uint32_t, int16_t, uint16_t>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "float";
@@ -440,6 +453,8 @@ namespace librapid {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = double;
 			using Packet							   = Vc::Vector<double>;
+			using PacketPromotions					   =
+			  std::tuple<float, int32_t, uint32_t, int16_t, uint16_t>;
 			using Device							   = device::CPU;
 			static constexpr int64_t packetWidth	   = Packet::size();
 			static constexpr char name[]			   = "double";
@@ -464,6 +479,46 @@ namespace librapid {
 			LIMIT_IMPL_CONSTEXPR(quietNaN) { return NUM_LIM(quiet_NaN); }
 			LIMIT_IMPL_CONSTEXPR(signalingNaN) { return NUM_LIM(signaling_NaN); }
 		};
+
+		template<typename T, typename Tuple>
+		struct TupleContains : std::false_type {};
+
+		template<typename T, typename... Types>
+		struct TupleContains<T, std::tuple<Types...>>
+				: std::bool_constant<(std::is_same_v<T, Types> || ...)> {};
+
+		/// Type promotion rules for vectorised expressions which mix scalar types. The arguments
+		/// of a Function are promoted to the Function's result type (following the usual
+		/// arithmetic conversions), so Array<float> + Array<int32_t> is evaluated on float
+		/// Packets. Vc only provides converting loads and simd_casts between some of its Packet
+		/// types, so each primitive lists the types it can be promoted from in
+		/// TypeInfo::PacketPromotions. Any other pair (int8_t to double, or int64_t to float, for
+		/// example) is evaluated with scalar operations instead. Packets of a vectorised type
+		/// need no promotion to that same type.
+		/// \tparam From The scalar type of the argument
+		/// \tparam To The scalar type the argument is promoted to
+		/// \return True if Packets of \p From can be promoted to Packets of \p To
+		template<typename From, typename To>
+		constexpr bool canPromotePacket() {
+			if constexpr (std::is_same_v<From, To>) {
+				return !std::is_same_v<typename TypeInfo<To>::Packet, std::false_type>;
+			} else if constexpr (std::is_arithmetic_v<From> && std::is_arithmetic_v<To>) {
+				return TupleContains<From, typename TypeInfo<To>::PacketPromotions>::value;
+			} else {
+				return false;
+			}
+		}
+
+		/// Scalars are broadcast across a Packet rather than loaded, so they can be promoted to
+		/// any vectorisable type they are convertible to.
+		/// \tparam From The type of the scalar
+		/// \tparam To The scalar type the value is promoted to
+		/// \return True if the scalar can be broadcast across Packets of \p To
+		template<typename From, typename To>
+		constexpr bool canPromoteScalar() {
+			return std::is_convertible_v<From, To> &&
+				   !std::is_same_v<typename TypeInfo<To>::Packet, std::false_type>;
+		}
 	} // namespace typetraits
 } // namespace librapid
 
@@ -0,0 +1,34 @@
+// Note: errors in this file will appear on the wrong line, since we copy another header file
+//       in to provide some utility functions (the include paths in Jitify are somewhat unreliable)
+
+#define UNARY_KERNEL_IMPL(NAME_, OP_)                                                              \
+	template<typename Destination, typename Data>                                                  \
+	__global__ void NAME_(size_t elements, Destination *dst, Data *data) {                         \
+		const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;                          \
+		if (kernelIndex < elements) { dst[kernelIndex] = OP_(data[kernelIndex]); }                 \
+	}
+
+UNARY_KERNEL_IMPL(sinArray, sin)
+UNARY_KERNEL_IMPL(cosArray, cos)
+UNARY_KERNEL_IMPL(tanArray, tan)
+UNARY_KERNEL_IMPL(asinArray, asin)
+UNARY_KERNEL_IMPL(acosArray, acos)
+UNARY_KERNEL_IMPL(atanArray, atan)
+UNARY_KERNEL_IMPL(sinhArray, sinh)
+UNARY_KERNEL_IMPL(coshArray, cosh)
+UNARY_KERNEL_IMPL(tanhArray, tanh)
+UNARY_KERNEL_IMPL(asinhArray, asinh)
+UNARY_KERNEL_IMPL(acoshArray, acosh)
+UNARY_KERNEL_IMPL(atanhArray, atanh)
+UNARY_KERNEL_IMPL(expArray, exp)
+UNARY_KERNEL_IMPL(exp2Array, exp2)
+UNARY_KERNEL_IMPL(logArray, log)
+UNARY_KERNEL_IMPL(log2Array, log2)
+UNARY_KERNEL_IMPL(log10Array, log10)
+UNARY_KERNEL_IMPL(sqrtArray, sqrt)
+UNARY_KERNEL_IMPL(cbrtArray, cbrt)
+UNARY_KERNEL_IMPL(absArray, abs)
+UNARY_KERNEL_IMPL(floorArray, floor)
+UNARY_KERNEL_IMPL(ceilArray, ceil)
+
+#undef UNARY_KERNEL_IMPL
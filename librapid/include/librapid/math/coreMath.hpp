@@ -18,7 +18,9 @@ namespace librapid {
 	/// \tparam T Data type
 	/// \param val Input set
 	/// \return Smallest element of the input set
-	template<typename T>
+	template<typename T, typename std::enable_if_t<typetraits::TypeInfo<std::decay_t<T>>::type ==
+													 detail::LibRapidType::Scalar,
+												   int> = 0>
 	T &&min(T &&val) {
 		return std::forward<T>(val);
 	}
@@ -27,7 +29,11 @@ namespace librapid {
 	/// \tparam Types Data types of the input values
 	/// \param vals Input values
 	/// \return The smallest element of the input values
-	template<typename T0, typename T1, typename... Ts>
+	template<typename T0, typename T1, typename... Ts,
+			 typename std::enable_if_t<
+			   typetraits::TypeInfo<std::decay_t<T0>>::type == detail::LibRapidType::Scalar &&
+				 typetraits::TypeInfo<std::decay_t<T1>>::type == detail::LibRapidType::Scalar,
+			   int> = 0>
 	auto min(T0 &&val1, T1 &&val2, Ts &&...vs) {
 		return (val1 < val2) ? min(val1, std::forward<Ts>(vs)...)
 							 : min(val2, std::forward<Ts>(vs)...);
@@ -37,7 +43,9 @@ namespace librapid {
 	/// \tparam T Data type
 	/// \param val Input set
 	/// \return Largest element of the input set
-	template<typename T>
+	template<typename T, typename std::enable_if_t<typetraits::TypeInfo<std::decay_t<T>>::type ==
+													 detail::LibRapidType::Scalar,
+												   int> = 0>
 	T &&max(T &&val) {
 		return std::forward<T>(val);
 	}
@@ -46,7 +54,11 @@ namespace librapid {
 	/// \tparam Types Data types of the input values
 	/// \param vals Input values
 	/// \return The largest element of the input values
-	template<typename T0, typename T1, typename... Ts>
+	template<typename T0, typename T1, typename... Ts,
+			 typename std::enable_if_t<
+			   typetraits::TypeInfo<std::decay_t<T0>>::type == detail::LibRapidType::Scalar &&
+				 typetraits::TypeInfo<std::decay_t<T1>>::type == detail::LibRapidType::Scalar,
+			   int> = 0>
 	auto max(T0 &&val1, T1 &&val2, Ts &&...vs) {
 		return (val1 > val2) ? max(val1, std::forward<Ts>(vs)...)
 							 : max(val2, std::forward<Ts>(vs)...);
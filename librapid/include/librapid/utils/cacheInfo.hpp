@@ -0,0 +1,20 @@
+#ifndef LIBRAPID_UTILS_CACHE_INFO_HPP
+#define LIBRAPID_UTILS_CACHE_INFO_HPP
+
+namespace librapid {
+	/// Sizes (in bytes) of the CPU's data caches. The default values are typical of a modern
+	/// desktop processor, and are used for any value which cannot be detected.
+	struct CacheInfo {
+		int64_t lineSize = 64;			  // Cache line size
+		int64_t l1		 = 32 * 1024;	  // L1 data cache size (per core)
+		int64_t l2		 = 256 * 1024;	  // L2 cache size (per core)
+		int64_t l3		 = 8 * 1024 * 1024; // L3 cache size (shared)
+	};
+
+	/// Query the operating system for the sizes of the CPU's data caches. This is called once
+	/// before main() to initialise global::cacheLineSize, global::l1CacheSize, etc.
+	/// \return The detected cache sizes
+	CacheInfo detectCacheInfo();
+} // namespace librapid
+
+#endif // LIBRAPID_UTILS_CACHE_INFO_HPP
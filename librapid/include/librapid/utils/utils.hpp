@@ -3,5 +3,6 @@
 
 #include "time.hpp"
 #include "memUtils.hpp"
+#include "cacheInfo.hpp"
 
 #endif // LIBRAPID_UTILS
\ No newline at end of file
@@ -0,0 +1,309 @@
+#include <librapid/librapid.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+
+#if defined(LIBRAPID_LINUX) || defined(LIBRAPID_APPLE)
+#	define LIBRAPID_POSIX_PWRITE
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+
+namespace librapid::detail {
+	/// The first bytes of a file in the LibRapid format
+	constexpr char nativeMagic[] = {'L', 'I', 'B', 'R', 'A', 'P', 'I', 'D'};
+
+	/// The version of the LibRapid format written by saveArray()
+	constexpr uint64_t nativeVersion = 1;
+
+	/// The number of bytes reserved for the type string in the LibRapid format
+	constexpr size_t nativeDescrBytes = 8;
+
+	/// The first bytes of a .npy file
+	constexpr char npyMagic[] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+	/// Elements start at a multiple of this many bytes into the file
+	constexpr size_t payloadAlignment = 64;
+
+	/// Files with more dimensions than this are assumed to be corrupt
+	constexpr uint64_t maxFileDims = 64;
+
+	/// Payloads are written in chunks of this many bytes
+	constexpr size_t writeChunkBytes = 64 * 1024 * 1024;
+
+	/// Payloads of at least this many bytes are written in parallel
+	constexpr size_t parallelWriteBytes = 1024 * 1024 * 1024;
+
+	/// Append the lowest \p bytes bytes of \p value to \p out, in little-endian order
+	void appendLittleEndian(std::string &out, uint64_t value, size_t bytes) {
+		for (size_t i = 0; i < bytes; ++i) out.push_back(static_cast<char>(value >> (i * 8)));
+	}
+
+	/// Decode a little-endian integer of \p bytes bytes
+	uint64_t decodeLittleEndian(const char *data, size_t bytes) {
+		uint64_t value = 0;
+		for (size_t i = 0; i < bytes; ++i) {
+			value |= static_cast<uint64_t>(static_cast<unsigned char>(data[i])) << (i * 8);
+		}
+		return value;
+	}
+
+	/// Read exactly \p bytes bytes from \p file, or throw
+	void readExactly(std::ifstream &file, char *data, size_t bytes, const std::string &path) {
+		file.read(data, static_cast<std::streamsize>(bytes));
+		if (static_cast<size_t>(file.gcount()) != bytes) {
+			throw std::runtime_error(
+			  fmt::format("\"{}\" is too short to be an array file (truncated header)", path));
+		}
+	}
+
+	/// Build the dtype string for \p kind and \p bytes, such as "<f8" or "|b1" (single bytes
+	/// have no byte order)
+	std::string npyDescr(char kind, size_t bytes) {
+		const uint16_t probe	= 1;
+		const bool littleEndian = *reinterpret_cast<const unsigned char *>(&probe) == 1;
+		const char order		= bytes == 1 ? '|' : (littleEndian ? '<' : '>');
+		return std::string(1, order) + kind + std::to_string(bytes);
+	}
+
+	std::string encodeArrayFileHeader(const std::string &descr, const std::vector<size_t> &shape,
+									  ArrayFileFormat format) {
+		std::string header;
+
+		if (format == ArrayFileFormat::Npy) {
+			std::string dims;
+			for (size_t dim : shape) dims += std::to_string(dim) + ", ";
+			// One-dimensional shapes keep their trailing comma, as in Python: "(3,)"
+			if (shape.size() > 1) dims.resize(dims.size() - 2);
+			if (shape.size() == 1) dims.resize(dims.size() - 1);
+
+			std::string dict = "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (" +
+							   dims + "), }";
+
+			// Version 1.0 stores the header length in 2 bytes, and version 2.0 in 4 bytes
+			size_t preamble = sizeof(npyMagic) + 4;
+			if (dict.size() + payloadAlignment > 0xffff) preamble += 2;
+			const size_t total =
+			  (preamble + dict.size() + 1 + payloadAlignment - 1) / payloadAlignment *
+			  payloadAlignment;
+			dict.append(total - preamble - dict.size() - 1, ' ');
+			dict.push_back('\n');
+
+			header.append(npyMagic, sizeof(npyMagic));
+			header.push_back(static_cast<char>(preamble == sizeof(npyMagic) + 4 ? 1 : 2));
+			header.push_back(0);
+			appendLittleEndian(header, dict.size(), preamble - sizeof(npyMagic) - 2);
+			header += dict;
+			return header;
+		}
+
+		LIBRAPID_ASSERT(format == ArrayFileFormat::Native, "Invalid array file format");
+		if (descr.size() > nativeDescrBytes) {
+			throw std::runtime_error(fmt::format("Type string '{}' is too long", descr));
+		}
+
+		// magic, version (4 bytes), payload offset (4 bytes), descr, ndim (8 bytes), dims
+		header.append(nativeMagic, sizeof(nativeMagic));
+		appendLittleEndian(header, nativeVersion, 4);
+		appendLittleEndian(header, 0, 4);
+		header += descr;
+		header.append(nativeDescrBytes - descr.size(), '\0');
+		appendLittleEndian(header, shape.size(), 8);
+		for (size_t dim : shape) appendLittleEndian(header, dim, 8);
+
+		header.resize((header.size() + payloadAlignment - 1) / payloadAlignment * payloadAlignment,
+					  '\0');
+		std::string offset;
+		appendLittleEndian(offset, header.size(), 4);
+		header.replace(sizeof(nativeMagic) + 4, 4, offset);
+		return header;
+	}
+
+	/// Return the text following \p key in a .npy header dictionary, with leading whitespace
+	/// removed
+	std::string npyDictValue(const std::string &dict, const std::string &key,
+							 const std::string &path) {
+		size_t pos = dict.find("'" + key + "'");
+		if (pos == std::string::npos) pos = dict.find("\"" + key + "\"");
+		if (pos == std::string::npos) {
+			throw std::runtime_error(
+			  fmt::format("The header of \"{}\" does not contain '{}'", path, key));
+		}
+		pos = dict.find(':', pos + key.size() + 2);
+		if (pos == std::string::npos) {
+			throw std::runtime_error(fmt::format("The header of \"{}\" is malformed", path));
+		}
+		pos = dict.find_first_not_of(" \t", pos + 1);
+		return pos == std::string::npos ? std::string() : dict.substr(pos);
+	}
+
+	/// Decode the dictionary in the header of a .npy file
+	ArrayFileHeader parseNpyHeader(const std::string &dict, const std::string &path) {
+		ArrayFileHeader header;
+
+		const std::string descr = npyDictValue(dict, "descr", path);
+		const size_t descrEnd	= descr.empty() ? std::string::npos : descr.find(descr[0], 1);
+		if (descrEnd == std::string::npos || (descr[0] != '\'' && descr[0] != '"')) {
+			throw std::runtime_error(
+			  fmt::format("\"{}\" has an unsupported element type: {}", path, descr));
+		}
+		header.descr = descr.substr(1, descrEnd - 1);
+
+		const std::string shape = npyDictValue(dict, "shape", path);
+		const size_t shapeEnd	= shape.find(')');
+		if (shape.empty() || shape[0] != '(' || shapeEnd == std::string::npos) {
+			throw std::runtime_error(fmt::format("\"{}\" has a malformed shape", path));
+		}
+		std::stringstream dims(shape.substr(1, shapeEnd - 1));
+		std::string dim;
+		while (std::getline(dims, dim, ',')) {
+			const size_t first = dim.find_first_not_of(" \t");
+			if (first == std::string::npos) continue;
+			header.shape.push_back(std::stoull(dim.substr(first)));
+		}
+
+		const bool fortranOrder = npyDictValue(dict, "fortran_order", path).rfind("True", 0) == 0;
+		if (fortranOrder && header.shape.size() > 1) {
+			throw std::runtime_error(fmt::format(
+			  "\"{}\" is stored in Fortran (column-major) order, which is not supported", path));
+		}
+
+		return header;
+	}
+
+	ArrayFileHeader readArrayFileHeader(const std::string &path) {
+		std::ifstream file(path, std::ios::binary);
+		if (!file.is_open()) {
+			throw std::runtime_error(fmt::format("Failed to open \"{}\"", path));
+		}
+
+		char prefix[sizeof(nativeMagic) + 8];
+		readExactly(file, prefix, sizeof(prefix), path);
+
+		if (std::memcmp(prefix, npyMagic, sizeof(npyMagic)) == 0) {
+			const int major = static_cast<unsigned char>(prefix[sizeof(npyMagic)]);
+			if (major < 1 || major > 3) {
+				throw std::runtime_error(
+				  fmt::format("\"{}\" uses unsupported .npy format version {}", path, major));
+			}
+
+			// Versions 2.0 and 3.0 store the header length in 4 bytes instead of 2
+			const size_t lengthBytes = major == 1 ? 2 : 4;
+			const size_t preamble	 = sizeof(npyMagic) + 2 + lengthBytes;
+			const size_t length = decodeLittleEndian(prefix + sizeof(npyMagic) + 2, lengthBytes);
+			if (preamble + length < sizeof(prefix)) {
+				throw std::runtime_error(fmt::format("The header of \"{}\" is malformed", path));
+			}
+
+			std::string dict(preamble + length, '\0');
+			std::memcpy(&dict[0], prefix, sizeof(prefix));
+			if (dict.size() > sizeof(prefix)) {
+				readExactly(file, &dict[sizeof(prefix)], dict.size() - sizeof(prefix), path);
+			}
+
+			ArrayFileHeader header = parseNpyHeader(dict.substr(preamble), path);
+			header.payloadOffset   = preamble + length;
+			return header;
+		}
+
+		if (std::memcmp(prefix, nativeMagic, sizeof(nativeMagic)) != 0) {
+			throw std::runtime_error(fmt::format("\"{}\" is not a LibRapid or .npy file", path));
+		}
+
+		const uint64_t version = decodeLittleEndian(prefix + sizeof(nativeMagic), 4);
+		if (version > nativeVersion) {
+			throw std::runtime_error(fmt::format(
+			  "\"{}\" uses version {} of the LibRapid array format, which is newer than this "
+			  "version of LibRapid supports",
+			  path,
+			  version));
+		}
+
+		ArrayFileHeader header;
+		header.payloadOffset = decodeLittleEndian(prefix + sizeof(nativeMagic) + 4, 4);
+
+		char fields[nativeDescrBytes + 8];
+		readExactly(file, fields, sizeof(fields), path);
+		header.descr = std::string(fields, std::find(fields, fields + nativeDescrBytes, '\0'));
+
+		const uint64_t ndim = decodeLittleEndian(fields + nativeDescrBytes, 8);
+		if (ndim > maxFileDims) {
+			throw std::runtime_error(fmt::format(
+			  "\"{}\" claims to have {} dimensions, and is probably corrupt", path, ndim));
+		}
+
+		std::vector<char> dims(ndim * 8);
+		if (!dims.empty()) readExactly(file, dims.data(), dims.size(), path);
+		for (uint64_t i = 0; i < ndim; ++i) {
+			header.shape.push_back(decodeLittleEndian(dims.data() + i * 8, 8));
+		}
+
+		return header;
+	}
+
+#if defined(LIBRAPID_POSIX_PWRITE)
+	/// Write all \p bytes bytes of \p data to \p fd at \p offset, retrying short writes
+	/// \return 0 on success, otherwise the errno value of the failure
+	int pwriteAll(int fd, const char *data, size_t bytes, size_t offset) {
+		while (bytes > 0) {
+			const ssize_t written = pwrite(fd, data, bytes, static_cast<off_t>(offset));
+			if (written < 0) {
+				if (errno == EINTR) continue;
+				return errno;
+			}
+			data += written;
+			bytes -= static_cast<size_t>(written);
+			offset += static_cast<size_t>(written);
+		}
+		return 0;
+	}
+#endif // LIBRAPID_POSIX_PWRITE
+
+	void writeArrayFile(const std::string &path, const std::string &header, const void *data,
+						size_t bytes) {
+#if defined(LIBRAPID_POSIX_PWRITE)
+		const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0) {
+			throw std::runtime_error(
+			  fmt::format("Failed to open \"{}\" for writing: {}", path, std::strerror(errno)));
+		}
+
+		// Size the file up front, so the chunks can be written in any order
+		int error = 0;
+		if (ftruncate(fd, static_cast<off_t>(header.size() + bytes)) != 0) error = errno;
+		if (error == 0) error = pwriteAll(fd, header.data(), header.size(), 0);
+
+		const auto *payload		= static_cast<const char *>(data);
+		const size_t chunkBytes = writeChunkBytes;
+		const auto chunks		= static_cast<int64_t>((bytes + chunkBytes - 1) / chunkBytes);
+		const size_t offset		= header.size();
+		const int64_t threads	= bytes >= parallelWriteBytes ? global::numThreads : 1;
+
+		if (error == 0) {
+#pragma omp parallel for shared(fd, payload, chunkBytes, chunks, bytes, offset, error)            \
+  default(none) schedule(dynamic) num_threads(threads) if (threads > 1)
+			for (int64_t chunk = 0; chunk < chunks; ++chunk) {
+				const size_t begin = static_cast<size_t>(chunk) * chunkBytes;
+				const size_t size  = std::min(chunkBytes, bytes - begin);
+				const int result   = pwriteAll(fd, payload + begin, size, offset + begin);
+				if (result != 0) {
+#pragma omp critical
+					error = result;
+				}
+			}
+		}
+
+		if (close(fd) != 0 && error == 0) error = errno;
+		if (error != 0) {
+			throw std::runtime_error(
+			  fmt::format("Failed to write \"{}\": {}", path, std::strerror(error)));
+		}
+#else
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(header.data(), static_cast<std::streamsize>(header.size()));
+		file.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+		if (!file) throw std::runtime_error(fmt::format("Failed to write \"{}\"", path));
+#endif
+	}
+} // namespace librapid::detail
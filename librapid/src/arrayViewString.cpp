@@ -0,0 +1,77 @@
+#include <librapid/librapid.hpp>
+
+namespace librapid::detail {
+	std::vector<int64_t> printedIndices(int64_t size, bool summarise) {
+		const int64_t edge = std::max<int64_t>(global::printEdgeItems, 0);
+		std::vector<int64_t> indices;
+
+		if (summarise && size > 2 * edge) {
+			indices.reserve(2 * edge + 1);
+			for (int64_t i = 0; i < edge; ++i) indices.push_back(i);
+			indices.push_back(-1);
+			for (int64_t i = size - edge; i < size; ++i) indices.push_back(i);
+		} else {
+			indices.reserve(size);
+			for (int64_t i = 0; i < size; ++i) indices.push_back(i);
+		}
+		return indices;
+	}
+
+	/// Append \p count spaces to a buffer
+	/// \param out The buffer to write to
+	/// \param count The number of spaces
+	static void appendSpaces(fmt::memory_buffer &out, int64_t count) {
+		for (int64_t i = 0; i < count; ++i) out.push_back(' ');
+	}
+
+	/// Write one dimension of a formatted array to a buffer
+	/// \param out The buffer to write to
+	/// \param array The formatted elements and their layout
+	/// \param dim The dimension to write
+	/// \param indent The indentation of the rows in this dimension
+	/// \param cell The index of the next element to write, which is advanced past the elements
+	/// written
+	static void writeFormattedDimension(fmt::memory_buffer &out, const FormattedArray &array,
+										size_t dim, int64_t indent, size_t &cell) {
+		static const std::string ellipsis = "...";
+		const size_t ndim				  = array.indices.size();
+		const auto &indices				  = array.indices[dim];
+
+		out.push_back('[');
+		for (size_t k = 0; k < indices.size(); ++k) {
+			if (dim + 1 == ndim) {
+				if (k > 0) out.push_back(' ');
+				if (indices[k] < 0) {
+					out.append(ellipsis.data(), ellipsis.data() + ellipsis.size());
+					continue;
+				}
+
+				const size_t begin = cell == 0 ? 0 : array.cellEnds[cell - 1];
+				const char *first  = array.cells.data() + begin;
+				const char *last   = array.cells.data() + array.cellEnds[cell++];
+				const auto width   = countWidth(first, last, array.alignPoint);
+				const auto &column = array.widths[k];
+				appendSpaces(out, column.first - width.first);
+				out.append(first, last);
+				appendSpaces(out, column.second - width.second);
+			} else {
+				if (k > 0) appendSpaces(out, indent + 1);
+				if (indices[k] < 0) {
+					out.append(ellipsis.data(), ellipsis.data() + ellipsis.size());
+				} else {
+					writeFormattedDimension(out, array, dim + 1, indent + 1, cell);
+				}
+				if (k + 1 != indices.size()) {
+					out.push_back('\n');
+					if (ndim - dim > 2) out.push_back('\n');
+				}
+			}
+		}
+		out.push_back(']');
+	}
+
+	void writeFormattedArray(fmt::memory_buffer &out, const FormattedArray &array) {
+		size_t cell = 0;
+		writeFormattedDimension(out, array, 0, 0, cell);
+	}
+} // namespace librapid::detail
@@ -0,0 +1,88 @@
+#include <librapid/librapid.hpp>
+
+#if defined(LIBRAPID_LINUX)
+#	include <unistd.h>
+#elif defined(LIBRAPID_APPLE)
+#	include <sys/sysctl.h>
+#endif
+
+namespace librapid {
+	namespace detail {
+#if defined(LIBRAPID_LINUX)
+		/// Read a cache size from sysfs, for systems where sysconf does not report it
+		/// \param index The cache index (index0 is usually L1d, index2 L2, index3 L3)
+		/// \param field The file to read ("size" or "coherency_line_size")
+		/// \return The value in bytes, or 0 if it could not be read
+		int64_t readSysfsCacheValue(int64_t index, const std::string &field) {
+			std::ifstream file(
+			  fmt::format("/sys/devices/system/cpu/cpu0/cache/index{}/{}", index, field));
+			if (!file.is_open()) return 0;
+
+			int64_t value = 0;
+			char suffix	  = 0;
+			file >> value >> suffix;
+			if (suffix == 'K') return value * 1024;
+			if (suffix == 'M') return value * 1024 * 1024;
+			return value;
+		}
+#elif defined(LIBRAPID_APPLE)
+		int64_t readSysctlValue(const char *name) {
+			int64_t value = 0;
+			size_t size	  = sizeof(value);
+			if (sysctlbyname(name, &value, &size, nullptr, 0) != 0) return 0;
+			return value;
+		}
+#endif
+	} // namespace detail
+
+	CacheInfo detectCacheInfo() {
+		CacheInfo info;
+		int64_t lineSize = 0, l1 = 0, l2 = 0, l3 = 0;
+
+#if defined(LIBRAPID_LINUX)
+#	if defined(_SC_LEVEL1_DCACHE_SIZE)
+		lineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+		l1		 = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+		l2		 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+		l3		 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#	endif
+		if (lineSize <= 0) lineSize = detail::readSysfsCacheValue(0, "coherency_line_size");
+		if (l1 <= 0) l1 = detail::readSysfsCacheValue(0, "size");
+		if (l2 <= 0) l2 = detail::readSysfsCacheValue(2, "size");
+		if (l3 <= 0) l3 = detail::readSysfsCacheValue(3, "size");
+#elif defined(LIBRAPID_APPLE)
+		lineSize = detail::readSysctlValue("hw.cachelinesize");
+		l1		 = detail::readSysctlValue("hw.l1dcachesize");
+		l2		 = detail::readSysctlValue("hw.l2cachesize");
+		l3		 = detail::readSysctlValue("hw.l3cachesize");
+#elif defined(LIBRAPID_WINDOWS)
+		DWORD bufferSize = 0;
+		GetLogicalProcessorInformation(nullptr, &bufferSize);
+		std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> buffer(
+		  bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+		if (!buffer.empty() && GetLogicalProcessorInformation(buffer.data(), &bufferSize)) {
+			for (const auto &processor : buffer) {
+				if (processor.Relationship != RelationCache) continue;
+				const CACHE_DESCRIPTOR &cache = processor.Cache;
+				if (cache.Type == CacheInstruction) continue;
+
+				const auto size = static_cast<int64_t>(cache.Size);
+				if (cache.Level == 1) {
+					l1		 = size;
+					lineSize = cache.LineSize;
+				} else if (cache.Level == 2) {
+					l2 = size;
+				} else if (cache.Level == 3) {
+					l3 = size;
+				}
+			}
+		}
+#endif
+
+		if (lineSize > 0) info.lineSize = lineSize;
+		if (l1 > 0) info.l1 = l1;
+		if (l2 > 0) info.l2 = l2;
+		if (l3 > 0) info.l3 = l3;
+		return info;
+	}
+} // namespace librapid
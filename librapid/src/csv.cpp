@@ -0,0 +1,62 @@
+#include <librapid/librapid.hpp>
+
+namespace librapid::detail {
+	/// Return the offset of the first line which starts at or after \p offset
+	/// \param text The contents of the file
+	/// \param bytes The length of the file, in bytes
+	/// \param offset The offset to search from
+	/// \return The offset of the start of the line, or \p bytes if there is none
+	size_t csvLineStart(const char *text, size_t bytes, size_t offset) {
+		if (offset == 0 || offset >= bytes || text[offset - 1] == '\n') {
+			return std::min(offset, bytes);
+		}
+		const auto *newline =
+		  static_cast<const char *>(std::memchr(text + offset, '\n', bytes - offset));
+		return newline == nullptr ? bytes : static_cast<size_t>(newline - text) + 1;
+	}
+
+	CSVLayout scanCSV(const char *text, size_t bytes, const CSVOptions &options,
+					  int64_t numParts) {
+		CSVLayout layout;
+
+		// Skip the title lines, whatever they contain
+		size_t start = 0;
+		for (int64_t i = 0; i < options.skipRows && start < bytes; ++i) {
+			start = csvLineStart(text, bytes, start + 1);
+		}
+
+		// The first row sets the number of columns
+		const char *cursor = text + start;
+		const char *rowBegin;
+		const char *rowEnd;
+		if (!nextCSVRow(cursor, text + bytes, options, rowBegin, rowEnd)) return layout;
+		layout.cols = std::count(rowBegin, rowEnd, options.delimiter) + 1;
+
+		// Split the file at the first line boundary after each equally spaced offset
+		numParts = std::max<int64_t>(1, numParts);
+		std::vector<size_t> bounds(numParts + 1);
+		for (int64_t i = 0; i <= numParts; ++i) {
+			const size_t offset = start + (bytes - start) * static_cast<size_t>(i) / numParts;
+			bounds[i]			= csvLineStart(text, bytes, offset);
+		}
+
+		std::vector<int64_t> rows(numParts, 0);
+
+#pragma omp parallel for shared(text, bounds, rows, numParts, options) default(none)             \
+  num_threads(numParts) if (numParts > 1)
+		for (int64_t i = 0; i < numParts; ++i) {
+			const char *partCursor = text + bounds[i];
+			const char *partEnd	   = text + bounds[i + 1];
+			const char *first;
+			const char *last;
+			while (nextCSVRow(partCursor, partEnd, options, first, last)) ++rows[i];
+		}
+
+		for (int64_t i = 0; i < numParts; ++i) {
+			if (bounds[i] == bounds[i + 1]) continue;
+			layout.parts.push_back({bounds[i], bounds[i + 1], layout.rows});
+			layout.rows += rows[i];
+		}
+		return layout;
+	}
+} // namespace librapid::detail
@@ -5,6 +5,17 @@ namespace librapid::global {
 	int64_t multithreadThreshold	 = 5000;
 	int64_t gemmMultithreadThreshold = 100;
 	int64_t numThreads				 = 8;
+	int64_t cacheLineSize			 = 64;
+	int64_t l1CacheSize				 = 32 * 1024;
+	int64_t l2CacheSize				 = 256 * 1024;
+	int64_t l3CacheSize				 = 8 * 1024 * 1024;
+	int64_t tiledEvaluationThreshold = 8;
+	int64_t memoryPoolCacheSize		 = 256 * 1024 * 1024;
+	HugePageMode hugePageMode		 = HugePageMode::None;
+	int64_t hugePageThreshold		 = 32 * 1024 * 1024;
+	int64_t streamingChunkBudget	 = 256 * 1024 * 1024;
+	int64_t printThreshold			 = 1000;
+	int64_t printEdgeItems			 = 3;
 
 #if defined(LIBRAPID_HAS_CUDA)
 	cudaStream_t cudaStream;
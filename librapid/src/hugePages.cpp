@@ -0,0 +1,170 @@
+#include <librapid/librapid.hpp>
+
+#include <mutex>
+#include <sstream>
+
+#if defined(LIBRAPID_LINUX)
+#	include <sys/mman.h>
+#endif
+
+namespace librapid::hugePages {
+	namespace detail {
+		/// A region of memory mapped by allocate()
+		struct Mapping {
+			size_t length;	   // The length of the mapping, in bytes
+			bool explicitHuge; // True if the mapping is backed by explicit huge pages
+		};
+
+		/// Every live mapping, so the correct function can be used to free a pointer, and
+		/// hugePageBytes() can report on it. Never destroyed, so arrays with static storage
+		/// duration can still be freed
+		struct Registry {
+			std::mutex mutex;
+			std::map<const void *, Mapping> mappings;
+		};
+
+		Registry &registry() {
+			static auto *instance = new Registry;
+			return *instance;
+		}
+
+#if defined(LIBRAPID_LINUX)
+		/// Map \p length bytes of anonymous memory aligned to a huge page boundary, which the
+		/// kernel requires before it will back the memory with transparent huge pages
+		/// \param length The number of bytes to map (a multiple of pageSize)
+		/// \return The mapped memory, or nullptr on failure
+		void *mapAligned(size_t length) {
+			const size_t padded = length + pageSize;
+			void *raw =
+			  mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (raw == MAP_FAILED) return nullptr;
+
+			// Unmap the unaligned head and the unused tail
+			const auto address		= reinterpret_cast<uintptr_t>(raw);
+			const uintptr_t aligned = (address + pageSize - 1) / pageSize * pageSize;
+			const size_t head		= aligned - address;
+			if (head > 0) munmap(raw, head);
+			munmap(reinterpret_cast<void *>(aligned + length), pageSize - head);
+			return reinterpret_cast<void *>(aligned);
+		}
+
+		/// Return the number of bytes of AnonHugePages in the mapping which contains \p ptr,
+		/// as reported by /proc/self/smaps
+		/// \param ptr A pointer into the mapping
+		/// \return The number of bytes backed by transparent huge pages
+		int64_t smapsHugePageBytes(const void *ptr) {
+			std::ifstream smaps("/proc/self/smaps");
+			if (!smaps.is_open()) return 0;
+
+			const auto address = reinterpret_cast<uintptr_t>(ptr);
+			bool inMapping	   = false;
+			std::string line;
+			while (std::getline(smaps, line)) {
+				// Mapping headers start with "start-end", in hexadecimal
+				const size_t dash  = line.find('-');
+				const size_t space = line.find(' ');
+				if (dash != std::string::npos && space != std::string::npos && dash < space &&
+					line.find(':') > space) {
+					const std::string first	 = line.substr(0, dash);
+					const std::string second = line.substr(dash + 1, space - dash - 1);
+					const auto start		 = std::stoull(first, nullptr, 16);
+					const auto end			 = std::stoull(second, nullptr, 16);
+					inMapping				 = start <= address && address < end;
+				} else if (inMapping && line.rfind("AnonHugePages:", 0) == 0) {
+					std::stringstream stream(line.substr(14));
+					int64_t kilobytes = 0;
+					stream >> kilobytes;
+					return kilobytes * 1024;
+				}
+			}
+			return 0;
+		}
+#endif // LIBRAPID_LINUX
+
+		void *allocate(size_t bytes, HugePageMode mode, size_t alignment) {
+			if (bytes < pageSize || mode == HugePageMode::None) {
+				return ::operator new(bytes, std::align_val_t(alignment));
+			}
+
+#if defined(LIBRAPID_LINUX)
+			const size_t length = (bytes + pageSize - 1) / pageSize * pageSize;
+			void *ptr			= nullptr;
+			bool explicitHuge	= false;
+
+			if (mode == HugePageMode::Explicit) {
+				// This fails unless huge pages have been reserved (vm.nr_hugepages)
+				ptr = mmap(nullptr,
+						   length,
+						   PROT_READ | PROT_WRITE,
+						   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+						   -1,
+						   0);
+				if (ptr == MAP_FAILED) {
+					ptr = nullptr;
+				} else {
+					explicitHuge = true;
+				}
+			}
+
+			if (ptr == nullptr) {
+				ptr = mapAligned(length);
+				if (ptr == nullptr) throw std::bad_alloc();
+#	if defined(MADV_HUGEPAGE)
+				madvise(ptr, length, MADV_HUGEPAGE);
+#	endif
+			}
+
+			Registry &reg = registry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			reg.mappings[ptr] = {length, explicitHuge};
+			return ptr;
+#else
+			return ::operator new(bytes, std::align_val_t(alignment));
+#endif
+		}
+
+		void deallocate(void *ptr, size_t bytes, size_t alignment) noexcept {
+			if (ptr == nullptr) return;
+			if (bytes >= pageSize && release(ptr)) return;
+			::operator delete(ptr, bytes, std::align_val_t(alignment));
+		}
+
+		bool release(void *ptr) noexcept {
+#if defined(LIBRAPID_LINUX)
+			Mapping mapping {};
+			{
+				Registry &reg = registry();
+				std::lock_guard<std::mutex> lock(reg.mutex);
+				auto it = reg.mappings.find(ptr);
+				if (it == reg.mappings.end()) return false;
+				mapping = it->second;
+				reg.mappings.erase(it);
+			}
+			munmap(ptr, mapping.length);
+			return true;
+#else
+			(void)ptr;
+			return false;
+#endif
+		}
+	} // namespace detail
+
+	int64_t hugePageBytes(const void *ptr) {
+#if defined(LIBRAPID_LINUX)
+		detail::Mapping mapping {};
+		{
+			detail::Registry &reg = detail::registry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			auto it = reg.mappings.find(ptr);
+			if (it == reg.mappings.end()) return 0;
+			mapping = it->second;
+		}
+
+		if (mapping.explicitHuge) return static_cast<int64_t>(mapping.length);
+		return detail::smapsHugePageBytes(ptr);
+#else
+		(void)ptr;
+		return 0;
+#endif
+	}
+} // namespace librapid::hugePages
@@ -0,0 +1,277 @@
+#include <librapid/librapid.hpp>
+
+#include <mutex>
+
+namespace librapid::memoryPool {
+	namespace detail {
+		// Every block is at least this large. Smaller requests are rounded up to it
+		constexpr size_t minBlockSize = 256;
+
+		// Each power of two is split into this many size classes, so at most 25% of a large
+		// block is wasted by rounding up
+		constexpr int64_t classesPerDoubling = 4;
+
+		// Requests larger than 2^maxBlockBits bytes are never satisfiable, so are rejected
+		constexpr int64_t maxBlockBits	 = 62;
+		constexpr int64_t numSizeClasses = (maxBlockBits + 1) * classesPerDoubling;
+
+		static_assert(minBlockSize % LIBRAPID_MEM_ALIGN == 0,
+					  "The smallest pool block must be a multiple of LIBRAPID_MEM_ALIGN");
+
+		using FreeLists = std::array<std::vector<void *>, numSizeClasses>;
+
+		/// Return the index of the size class used for a request of \p bytes bytes. Class 0
+		/// holds blocks of minBlockSize bytes. Otherwise, the classes for 2^(bits-1) < bytes <=
+		/// 2^bits start at index bits * classesPerDoubling, and are evenly spaced.
+		/// \param bytes The number of bytes requested
+		/// \return The size class index
+		int64_t sizeClass(size_t bytes) {
+			if (bytes <= minBlockSize) return 0;
+			if (bytes > (size_t(1) << maxBlockBits)) throw std::bad_alloc();
+
+			int64_t bits = 0;
+			while ((size_t(1) << bits) < bytes) ++bits;
+			const size_t step = (size_t(1) << bits) / (2 * classesPerDoubling);
+			const auto steps  = static_cast<int64_t>((bytes + step - 1) / step);
+			return bits * classesPerDoubling + steps - classesPerDoubling - 1;
+		}
+
+		/// Return the size (in bytes) of the blocks in a size class
+		/// \param cls The size class index
+		/// \return The block size
+		size_t blockSizeOfClass(int64_t cls) {
+			if (cls == 0) return minBlockSize;
+			const int64_t bits = cls / classesPerDoubling;
+			const size_t step  = (size_t(1) << bits) / (2 * classesPerDoubling);
+			return step * static_cast<size_t>(cls % classesPerDoubling + classesPerDoubling + 1);
+		}
+
+		// Counters are constant-initialised atomics, so they remain usable while static objects
+		// (which may own pool memory) are being destroyed
+		std::atomic<int64_t> allocations(0);
+		std::atomic<int64_t> cacheHits(0);
+		std::atomic<int64_t> bytesInUse(0);
+		std::atomic<int64_t> peakBytesInUse(0);
+		std::atomic<int64_t> bytesCached(0);
+		std::atomic<int64_t> bytesFromSystem(0);
+
+		void *systemAllocate(size_t blockSize) {
+			void *ptr = ::operator new(blockSize, std::align_val_t(LIBRAPID_MEM_ALIGN));
+			bytesFromSystem += static_cast<int64_t>(blockSize);
+			return ptr;
+		}
+
+		void systemFree(void *ptr, size_t blockSize) noexcept {
+			::operator delete(ptr, blockSize, std::align_val_t(LIBRAPID_MEM_ALIGN));
+			bytesFromSystem -= static_cast<int64_t>(blockSize);
+		}
+
+		/// A set of free lists and the number of bytes they hold
+		struct Cache {
+			FreeLists freeLists;
+			int64_t bytes = 0;
+
+			/// Take a block from the free list for \p cls, if there is one
+			/// \param cls The size class index
+			/// \return The block, or nullptr if the free list is empty
+			void *pop(int64_t cls) noexcept {
+				auto &list = freeLists[cls];
+				if (list.empty()) return nullptr;
+				void *ptr = list.back();
+				list.pop_back();
+				bytes -= static_cast<int64_t>(blockSizeOfClass(cls));
+				return ptr;
+			}
+
+			/// Add a block to the free list for \p cls, provided this does not take the cache
+			/// above \p limit bytes
+			/// \param ptr The block to cache
+			/// \param cls The size class index
+			/// \param limit The maximum number of bytes to cache, or -1 for no limit
+			/// \return True if the block was cached
+			bool push(void *ptr, int64_t cls, int64_t limit) noexcept {
+				const auto blockSize = static_cast<int64_t>(blockSizeOfClass(cls));
+				if (limit >= 0 && bytes + blockSize > limit) return false;
+				try {
+					freeLists[cls].push_back(ptr);
+				} catch (...) { return false; }
+				bytes += blockSize;
+				bytesCached += blockSize;
+				return true;
+			}
+
+			/// Free cached blocks, largest first, until at most \p limit bytes remain
+			/// \param limit The number of bytes to leave cached
+			void release(int64_t limit) noexcept {
+				for (int64_t cls = numSizeClasses - 1; cls >= 0 && bytes > limit; --cls) {
+					const size_t blockSize = blockSizeOfClass(cls);
+					auto &list			   = freeLists[cls];
+					while (!list.empty() && bytes > limit) {
+						systemFree(list.back(), blockSize);
+						list.pop_back();
+						bytes -= static_cast<int64_t>(blockSize);
+						bytesCached -= static_cast<int64_t>(blockSize);
+					}
+				}
+			}
+		};
+
+		/// Blocks freed once a thread's cache is full, or by a thread which has exited
+		struct SharedCache {
+			std::mutex mutex;
+			Cache cache;
+		};
+
+		/// The shared cache is never destroyed, so blocks can be freed into it by the
+		/// destructors of static objects
+		SharedCache &sharedCache() {
+			static auto *shared = new SharedCache;
+			return *shared;
+		}
+
+		thread_local bool threadCacheDestroyed = false;
+		thread_local int64_t arenaDepth		   = 0;
+
+		/// Each thread caches the blocks it frees, so the common case of a temporary being
+		/// allocated and freed on the same thread does not need a lock
+		struct ThreadCache {
+			Cache cache;
+
+			~ThreadCache() {
+				// Hand the cached blocks to the shared cache, so other threads can reuse them
+				SharedCache &shared = sharedCache();
+				{
+					std::lock_guard<std::mutex> lock(shared.mutex);
+					for (int64_t cls = 0; cls < numSizeClasses; ++cls) {
+						while (void *ptr = cache.pop(cls)) {
+							bytesCached -= static_cast<int64_t>(blockSizeOfClass(cls));
+							if (!shared.cache.push(ptr, cls, global::memoryPoolCacheSize)) {
+								systemFree(ptr, blockSizeOfClass(cls));
+							}
+						}
+					}
+				}
+				threadCacheDestroyed = true;
+			}
+		};
+
+		/// Return the calling thread's cache, or nullptr if it has already been destroyed
+		/// (which can happen while the thread's other thread_local objects are destroyed)
+		Cache *threadCache() {
+			if (threadCacheDestroyed) return nullptr;
+			thread_local ThreadCache cache;
+			return &cache.cache;
+		}
+
+		void *allocate(size_t bytes) {
+			const int64_t cls	 = sizeClass(bytes);
+			const auto blockSize = static_cast<int64_t>(blockSizeOfClass(cls));
+			++allocations;
+
+			void *ptr = nullptr;
+			if (Cache *local = threadCache()) ptr = local->pop(cls);
+			if (!ptr) {
+				SharedCache &shared = sharedCache();
+				std::lock_guard<std::mutex> lock(shared.mutex);
+				ptr = shared.cache.pop(cls);
+			}
+
+			if (ptr) {
+				++cacheHits;
+				bytesCached -= blockSize;
+			} else {
+				try {
+					ptr = systemAllocate(static_cast<size_t>(blockSize));
+				} catch (const std::bad_alloc &) {
+					// Cached memory may be all that stands between us and success
+					trim();
+					ptr = systemAllocate(static_cast<size_t>(blockSize));
+				}
+			}
+
+			const int64_t inUse = bytesInUse += blockSize;
+			int64_t peak		= peakBytesInUse.load();
+			while (inUse > peak && !peakBytesInUse.compare_exchange_weak(peak, inUse)) {}
+			return ptr;
+		}
+
+		void deallocate(void *ptr, size_t bytes) noexcept {
+			if (ptr == nullptr) return;
+			// sizeClass cannot throw here, since bytes was accepted by allocate()
+			const int64_t cls = sizeClass(bytes);
+			bytesInUse -= static_cast<int64_t>(blockSizeOfClass(cls));
+
+			if (Cache *local = threadCache()) {
+				const int64_t limit = arenaDepth > 0 ? -1 : global::memoryPoolCacheSize;
+				if (local->push(ptr, cls, limit)) return;
+			}
+
+			SharedCache &shared = sharedCache();
+			{
+				std::lock_guard<std::mutex> lock(shared.mutex);
+				if (shared.cache.push(ptr, cls, global::memoryPoolCacheSize)) return;
+			}
+			systemFree(ptr, blockSizeOfClass(cls));
+		}
+
+#if defined(LIBRAPID_HAS_CUDA)
+		void retainDeviceMemory() {
+			static const bool retained = [] {
+				int device = 0;
+				cudaMemPool_t pool;
+				if (cudaGetDevice(&device) != cudaSuccess ||
+					cudaDeviceGetDefaultMemPool(&pool, device) != cudaSuccess) {
+					return false;
+				}
+				auto threshold = static_cast<uint64_t>(global::memoryPoolCacheSize);
+				return cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &threshold) ==
+					   cudaSuccess;
+			}();
+			(void)retained;
+		}
+#endif // LIBRAPID_HAS_CUDA
+	} // namespace detail
+
+	Stats stats() {
+		Stats res;
+		res.allocations		= detail::allocations.load();
+		res.cacheHits		= detail::cacheHits.load();
+		res.bytesInUse		= detail::bytesInUse.load();
+		res.peakBytesInUse	= detail::peakBytesInUse.load();
+		res.bytesCached		= detail::bytesCached.load();
+		res.bytesFromSystem = detail::bytesFromSystem.load();
+		return res;
+	}
+
+	void resetStats() {
+		detail::allocations	   = 0;
+		detail::cacheHits	   = 0;
+		detail::peakBytesInUse = detail::bytesInUse.load();
+	}
+
+	void trim() {
+		if (detail::Cache *local = detail::threadCache()) local->release(0);
+
+		detail::SharedCache &shared = detail::sharedCache();
+		std::lock_guard<std::mutex> lock(shared.mutex);
+		shared.cache.release(0);
+
+#if defined(LIBRAPID_HAS_CUDA)
+		int device = 0;
+		cudaMemPool_t pool;
+		if (cudaGetDevice(&device) == cudaSuccess &&
+			cudaDeviceGetDefaultMemPool(&pool, device) == cudaSuccess) {
+			cudaMemPoolTrimTo(pool, 0);
+		}
+#endif // LIBRAPID_HAS_CUDA
+	}
+
+	Arena::Arena() { ++detail::arenaDepth; }
+
+	Arena::~Arena() {
+		if (--detail::arenaDepth > 0) return;
+		if (detail::Cache *local = detail::threadCache()) {
+			local->release(global::memoryPoolCacheSize);
+		}
+	}
+} // namespace librapid::memoryPool
@@ -0,0 +1,234 @@
+#include <librapid/librapid.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+
+#if defined(LIBRAPID_LINUX) || defined(LIBRAPID_APPLE)
+#	define LIBRAPID_POSIX_MMAP
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace librapid::detail {
+	class MappedFile {
+	public:
+		MappedFile(const std::string &path, MmapMode mode, MmapAdvice advice, size_t offset) :
+				m_path(path), m_mode(mode), m_advice(advice), m_offset(offset) {
+#if defined(LIBRAPID_POSIX_MMAP)
+			const int flags = mode == MmapMode::ReadWrite ? O_RDWR | O_CREAT : O_RDONLY;
+			m_fd			= open(path.c_str(), flags, 0644);
+			if (m_fd < 0) {
+				throw std::runtime_error(
+				  fmt::format("Failed to open \"{}\" for mapping: {}", path, std::strerror(errno)));
+			}
+#else
+			throw std::runtime_error("Memory-mapped files are not supported on this platform");
+#endif
+		}
+
+		MappedFile(const MappedFile &)			  = delete;
+		MappedFile &operator=(const MappedFile &) = delete;
+
+		~MappedFile() {
+#if defined(LIBRAPID_POSIX_MMAP)
+			// Existing mappings remain valid after the file is closed
+			if (m_fd >= 0) close(m_fd);
+#endif
+		}
+
+		/// Return the size of the file, in bytes
+		LIBRAPID_NODISCARD size_t fileSize() const {
+#if defined(LIBRAPID_POSIX_MMAP)
+			struct stat info {};
+			if (fstat(m_fd, &info) != 0) {
+				throw std::runtime_error(fmt::format(
+				  "Failed to read the size of \"{}\": {}", m_path, std::strerror(errno)));
+			}
+			return static_cast<size_t>(info.st_size);
+#else
+			return 0;
+#endif
+		}
+
+		const std::string m_path;
+		const MmapMode m_mode;
+		const MmapAdvice m_advice;
+		const size_t m_offset;
+		int m_fd = -1;
+	};
+
+	/// A region mapped by mapFile()
+	struct FileMapping {
+		void *base;	   // The page-aligned start of the mapping
+		size_t length; // The length of the mapping, in bytes
+		MmapMode mode; // How the file is mapped
+	};
+
+	/// Every live mapping, keyed by the pointer returned by mapFile(). Never destroyed, so
+	/// arrays with static storage duration can still be unmapped
+	struct MappingRegistry {
+		std::mutex mutex;
+		std::map<void *, FileMapping> mappings;
+	};
+
+	MappingRegistry &mappingRegistry() {
+		static auto *instance = new MappingRegistry;
+		return *instance;
+	}
+
+	std::shared_ptr<MappedFile> openMappedFile(const std::string &path, MmapMode mode,
+											   MmapAdvice advice, size_t offset) {
+		return std::make_shared<MappedFile>(path, mode, advice, offset);
+	}
+
+	void *mapFile(MappedFile &file, size_t bytes) {
+		if (bytes == 0) return nullptr;
+
+#if defined(LIBRAPID_POSIX_MMAP)
+		const size_t end = file.m_offset + bytes;
+		if (file.fileSize() < end) {
+			if (file.m_mode != MmapMode::ReadWrite) {
+				throw std::runtime_error(fmt::format(
+				  "Cannot map {} bytes at offset {} of \"{}\", which only contains {} bytes",
+				  bytes,
+				  file.m_offset,
+				  file.m_path,
+				  file.fileSize()));
+			}
+			if (ftruncate(file.m_fd, static_cast<off_t>(end)) != 0) {
+				throw std::runtime_error(fmt::format("Failed to extend \"{}\" to {} bytes: {}",
+													 file.m_path,
+													 end,
+													 std::strerror(errno)));
+			}
+		}
+
+		// The offset passed to mmap must be a multiple of the page size
+		const auto pageSize	  = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		const size_t pageBase = file.m_offset / pageSize * pageSize;
+		const size_t delta	  = file.m_offset - pageBase;
+		const size_t length	  = bytes + delta;
+
+		const int prot	= file.m_mode == MmapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+		const int flags = file.m_mode == MmapMode::ReadWrite ? MAP_SHARED : MAP_PRIVATE;
+		void *base = mmap(nullptr, length, prot, flags, file.m_fd, static_cast<off_t>(pageBase));
+		if (base == MAP_FAILED) {
+			throw std::runtime_error(
+			  fmt::format("Failed to map \"{}\": {}", file.m_path, std::strerror(errno)));
+		}
+
+		int advice = MADV_NORMAL;
+		switch (file.m_advice) {
+			case MmapAdvice::Normal: advice = MADV_NORMAL; break;
+			case MmapAdvice::Sequential: advice = MADV_SEQUENTIAL; break;
+			case MmapAdvice::Random: advice = MADV_RANDOM; break;
+			case MmapAdvice::WillNeed: advice = MADV_WILLNEED; break;
+		}
+		madvise(base, length, advice); // Only a hint, so failure is not an error
+
+		void *ptr			 = static_cast<char *>(base) + delta;
+		MappingRegistry &reg = mappingRegistry();
+		std::lock_guard<std::mutex> lock(reg.mutex);
+		reg.mappings[ptr] = {base, length, file.m_mode};
+		return ptr;
+#else
+		throw std::runtime_error("Memory-mapped files are not supported on this platform");
+#endif
+	}
+
+	bool unmapFile(void *ptr) noexcept {
+#if defined(LIBRAPID_POSIX_MMAP)
+		FileMapping mapping {};
+		{
+			MappingRegistry &reg = mappingRegistry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			auto it = reg.mappings.find(ptr);
+			if (it == reg.mappings.end()) return false;
+			mapping = it->second;
+			reg.mappings.erase(it);
+		}
+		// Dirty pages of shared mappings are written back by the kernel after munmap
+		munmap(mapping.base, mapping.length);
+		return true;
+#else
+		(void)ptr;
+		return false;
+#endif
+	}
+
+#if defined(LIBRAPID_POSIX_MMAP)
+	/// Find the mapping which contains the whole of [ptr, ptr + bytes), and round the range out
+	/// to whole pages
+	/// \param ptr The start of the range
+	/// \param bytes The length of the range, in bytes
+	/// \param mapping Set to the mapping containing the range
+	/// \param pages Set to the page-aligned start of the range
+	/// \param pageBytes Set to the length of the page-aligned range
+	/// \return True if the range is within a mapping created by mapFile()
+	bool findMappedPages(const void *ptr, size_t bytes, FileMapping &mapping, char *&pages,
+						 size_t &pageBytes) noexcept {
+		if (ptr == nullptr || bytes == 0) return false;
+
+		{
+			MappingRegistry &reg = mappingRegistry();
+			std::lock_guard<std::mutex> lock(reg.mutex);
+			auto it = reg.mappings.upper_bound(const_cast<void *>(ptr));
+			if (it == reg.mappings.begin()) return false;
+			mapping = (--it)->second;
+		}
+
+		const auto address = reinterpret_cast<uintptr_t>(ptr);
+		const auto base	   = reinterpret_cast<uintptr_t>(mapping.base);
+		if (address < base || address + bytes > base + mapping.length) return false;
+
+		const auto pageSize	  = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+		const uintptr_t start = address / pageSize * pageSize;
+		const uintptr_t end	  = (address + bytes + pageSize - 1) / pageSize * pageSize;
+		pages				  = reinterpret_cast<char *>(start);
+		pageBytes			  = std::min(end, base + mapping.length) - start;
+		return true;
+	}
+#endif // LIBRAPID_POSIX_MMAP
+
+	void prefetchMappedRange(const void *ptr, size_t bytes) noexcept {
+#if defined(LIBRAPID_POSIX_MMAP)
+		FileMapping mapping {};
+		char *pages		 = nullptr;
+		size_t pageBytes = 0;
+		if (findMappedPages(ptr, bytes, mapping, pages, pageBytes)) {
+			madvise(pages, pageBytes, MADV_WILLNEED);
+		}
+#else
+		(void)ptr;
+		(void)bytes;
+#endif
+	}
+
+	void releaseMappedRange(const void *ptr, size_t bytes) noexcept {
+#if defined(LIBRAPID_POSIX_MMAP)
+		FileMapping mapping {};
+		char *pages		 = nullptr;
+		size_t pageBytes = 0;
+		if (!findMappedPages(ptr, bytes, mapping, pages, pageBytes)) return;
+
+		// Dropping a page of a private mapping would discard any changes made to it
+		if (mapping.mode == MmapMode::CopyOnWrite) return;
+
+		// Pages of shared mappings stay in the page cache (and changes are still written back
+		// to the file), but no longer count towards the resident set of the process
+		if (mapping.mode == MmapMode::ReadWrite) msync(pages, pageBytes, MS_ASYNC);
+		madvise(pages, pageBytes, MADV_DONTNEED);
+#else
+		(void)ptr;
+		(void)bytes;
+#endif
+	}
+
+	size_t mappedFileBytes(const MappedFile &file) {
+		const size_t size = file.fileSize();
+		return size > file.m_offset ? size - file.m_offset : 0;
+	}
+} // namespace librapid::detail
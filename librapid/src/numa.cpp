@@ -0,0 +1,250 @@
+#include <librapid/librapid.hpp>
+
+#include <sstream>
+#include <thread>
+
+#if defined(LIBRAPID_LINUX)
+#	include <pthread.h>
+#	include <sched.h>
+#	include <sys/mman.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+namespace librapid::numa {
+	namespace detail {
+		// Pages are touched at this granularity. Touching more often than the real page size
+		// (if it is larger) is harmless
+		constexpr size_t touchSize = 4096;
+
+		// From <linux/mempolicy.h>, which is not always installed
+		constexpr int mpolInterleave = 3;
+		constexpr int mpolModeMask	 = 0xff; // Mode flags are stored in the upper bits
+		constexpr int mpolFNode		 = 1;
+		constexpr int mpolFAddr		 = 2;
+		constexpr size_t wordBits	 = sizeof(unsigned long) * 8;
+
+		/// Parse a Linux CPU or node list, such as "0-3,8-11"
+		/// \param list The list to parse
+		/// \return The IDs in the list
+		std::vector<int64_t> parseIdList(const std::string &list) {
+			std::vector<int64_t> res;
+			std::stringstream stream(list);
+			std::string range;
+			while (std::getline(stream, range, ',')) {
+				if (range.empty() || range == "\n") continue;
+				const size_t dash	= range.find('-');
+				const int64_t first = std::stoll(range.substr(0, dash));
+				const int64_t last =
+				  dash == std::string::npos ? first : std::stoll(range.substr(dash + 1));
+				for (int64_t id = first; id <= last; ++id) res.push_back(id);
+			}
+			return res;
+		}
+
+#if defined(LIBRAPID_LINUX)
+		/// Read the first line of a file in sysfs
+		/// \param path The file to read
+		/// \return The first line, or an empty string if the file could not be read
+		std::string readSysfsLine(const std::string &path) {
+			std::ifstream file(path);
+			std::string line;
+			if (file.is_open()) std::getline(file, line);
+			return line;
+		}
+#endif
+
+		Topology &topologyInstance() {
+			static Topology instance = detectTopology();
+			return instance;
+		}
+	} // namespace detail
+
+	Topology detectTopology() {
+		Topology res;
+
+#if defined(LIBRAPID_LINUX)
+		const std::string possible = detail::readSysfsLine("/sys/devices/system/node/possible");
+		if (!possible.empty()) {
+			for (int64_t id : detail::parseIdList(possible)) {
+				const std::string cpus = detail::readSysfsLine(
+				  fmt::format("/sys/devices/system/node/node{}/cpulist", id));
+				if (cpus.empty()) continue; // Offline, or a memory-only node
+				res.nodes.push_back({id, detail::parseIdList(cpus)});
+			}
+		}
+#endif
+
+		if (res.nodes.empty()) {
+			// Treat the whole machine as a single node
+			Node node {0, {}};
+			const auto cpus = static_cast<int64_t>(std::thread::hardware_concurrency());
+			for (int64_t cpu = 0; cpu < std::max<int64_t>(cpus, 1); ++cpu) {
+				node.cpus.push_back(cpu);
+			}
+			res.nodes.push_back(node);
+		}
+
+		return res;
+	}
+
+	const Topology &topology() { return detail::topologyInstance(); }
+
+	void setTopology(const Topology &topology) {
+		LIBRAPID_ASSERT(topology.numNodes() > 0, "A NUMA topology must have at least one node");
+		detail::topologyInstance() = topology;
+	}
+
+	int64_t threadNode(int64_t thread, int64_t numThreads) {
+		if (numThreads <= 0) return 0;
+		const int64_t nodes = topology().numNodes();
+		return std::min(thread * nodes / numThreads, nodes - 1);
+	}
+
+	bool bindThreads() {
+#if defined(LIBRAPID_LINUX) && defined(LIBRAPID_HAS_OMP)
+		const Topology &topo  = topology();
+		const int64_t threads = global::numThreads;
+		int64_t failures	  = 0;
+
+#	pragma omp parallel shared(topo, threads) default(none) reduction(+ : failures)               \
+	  num_threads(threads)
+		{
+			const int64_t thread = omp_get_thread_num();
+			const Node &node	 = topo.nodes[threadNode(thread, omp_get_num_threads())];
+
+			cpu_set_t cpus;
+			CPU_ZERO(&cpus);
+			for (int64_t cpu : node.cpus) {
+				if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(static_cast<int>(cpu), &cpus);
+			}
+			if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) ++failures;
+		}
+
+		return failures == 0;
+#else
+		return false;
+#endif
+	}
+
+	namespace detail {
+		void *allocate(size_t bytes, size_t alignment) {
+#if defined(LIBRAPID_LINUX)
+			// Fresh mappings are page-aligned and untouched, so their pages can still be placed
+			if (bytes >= touchSize && alignment <= touchSize) {
+				void *ptr =
+				  mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (ptr == MAP_FAILED) throw std::bad_alloc();
+				return ptr;
+			}
+#endif
+			return ::operator new(bytes, std::align_val_t(alignment));
+		}
+
+		void deallocate(void *ptr, size_t bytes, size_t alignment) noexcept {
+			if (ptr == nullptr) return;
+#if defined(LIBRAPID_LINUX)
+			if (bytes >= touchSize && alignment <= touchSize) {
+				munmap(ptr, bytes);
+				return;
+			}
+#endif
+			::operator delete(ptr, bytes, std::align_val_t(alignment));
+		}
+
+		void firstTouch(void *ptr, size_t bytes, size_t elementSize, int64_t *touchedBy) {
+			const int64_t threads = global::numThreads;
+			if (threads <= 1 || bytes == 0) return;
+
+			auto *data				= static_cast<volatile char *>(ptr);
+			const auto elements		= static_cast<int64_t>(bytes / elementSize);
+			const auto elementBytes = static_cast<int64_t>(elementSize);
+			const auto pageBytes	= static_cast<int64_t>(touchSize);
+
+			// Iteration i of a static schedule with one iteration per thread runs on thread i,
+			// which then touches the pages starting in its share of the elements
+#pragma omp parallel for shared(data, elements, elementBytes, pageBytes, threads, touchedBy)       \
+  default(none) schedule(static) num_threads(threads)
+			for (int64_t thread = 0; thread < threads; ++thread) {
+#if defined(LIBRAPID_HAS_OMP)
+				const int64_t touching = omp_get_thread_num();
+#else
+				const int64_t touching = 0;
+#endif
+				const int64_t begin = elements * thread / threads * elementBytes;
+				const int64_t end	= elements * (thread + 1) / threads * elementBytes;
+				// The page containing the start of the array is always touched by thread 0
+				int64_t offset = (begin + pageBytes - 1) / pageBytes * pageBytes;
+				for (; offset < end; offset += pageBytes) {
+					data[offset] = 0;
+					if (touchedBy) touchedBy[offset / pageBytes] = touching;
+				}
+			}
+		}
+
+		bool interleave(void *ptr, size_t bytes) {
+#if defined(LIBRAPID_LINUX) && defined(SYS_mbind)
+			const Topology &topo = topology();
+			if (topo.numNodes() < 2 || bytes == 0) return false;
+
+			int64_t maxNode = 0;
+			for (const Node &node : topo.nodes) maxNode = std::max(maxNode, node.id);
+			std::vector<unsigned long> mask(static_cast<size_t>(maxNode) / wordBits + 1, 0);
+			for (const Node &node : topo.nodes) {
+				const auto id = static_cast<size_t>(node.id);
+				mask[id / wordBits] |= 1UL << (id % wordBits);
+			}
+
+			const size_t length = (bytes + touchSize - 1) / touchSize * touchSize;
+			// The kernel ignores the last bit of maxnode, so pass one more than the mask size
+			const long res = syscall(SYS_mbind,
+									 ptr,
+									 length,
+									 mpolInterleave,
+									 mask.data(),
+									 mask.size() * wordBits + 1,
+									 0);
+			return res == 0;
+#else
+			(void)ptr;
+			(void)bytes;
+			return false;
+#endif
+		}
+
+		int64_t pageNode(const void *ptr) {
+#if defined(LIBRAPID_LINUX) && defined(SYS_get_mempolicy)
+			int node = -1;
+			const long res =
+			  syscall(SYS_get_mempolicy, &node, nullptr, 0, ptr, mpolFNode | mpolFAddr);
+			return res == 0 ? node : -1;
+#else
+			(void)ptr;
+			return -1;
+#endif
+		}
+
+		std::vector<int64_t> interleavedNodes(const void *ptr) {
+			std::vector<int64_t> res;
+#if defined(LIBRAPID_LINUX) && defined(SYS_get_mempolicy)
+			// Large enough for any kernel's MAX_NUMNODES
+			constexpr size_t maxNodes = 4096;
+			std::vector<unsigned long> mask(maxNodes / wordBits, 0);
+			int mode = 0;
+			if (syscall(SYS_get_mempolicy, &mode, mask.data(), maxNodes, ptr, mpolFAddr) != 0 ||
+				(mode & mpolModeMask) != mpolInterleave) {
+				return res;
+			}
+
+			for (size_t id = 0; id < maxNodes; ++id) {
+				if (mask[id / wordBits] & (1UL << (id % wordBits))) {
+					res.push_back(static_cast<int64_t>(id));
+				}
+			}
+#else
+			(void)ptr;
+#endif
+			return res;
+		}
+	} // namespace detail
+} // namespace librapid::numa
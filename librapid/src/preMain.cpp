@@ -10,6 +10,19 @@ namespace librapid::detail {
 			system(("chcp " + std::to_string(CP_UTF8)).c_str());
 #endif // LIBRAPID_WINDOWS
 
+			CacheInfo cacheInfo	  = detectCacheInfo();
+			global::cacheLineSize = cacheInfo.lineSize;
+			global::l1CacheSize	  = cacheInfo.l1;
+			global::l2CacheSize	  = cacheInfo.l2;
+			global::l3CacheSize	  = cacheInfo.l3;
+
+			// Large arrays usually start at the same offset within a page, so the elements a
+			// streamed expression reads from each array (and writes) share one L1 set. L1 caches
+			// are indexed within a 4 KiB page, so a set has l1CacheSize / 4 KiB ways (8 for
+			// 32 KiB), and once every way is in use each load evicts a line another stream still
+			// needs. "Benchmark Tiled Evaluation" measures the real crossover point
+			global::tiledEvaluationThreshold = std::max<int64_t>(global::l1CacheSize / 4096, 2);
+
 			preMainRun = true;
 		}
 	}
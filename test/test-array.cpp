@@ -32,6 +32,10 @@ namespace lrc = librapid;
 		lrc::Array<SCALAR, DEVICE> testE(std::move(tmpShape));                                     \
 		REQUIRE(testE.shape() == lrc::Array<SCALAR, DEVICE>::ShapeType {2, 3});                    \
                                                                                                    \
+		auto testEmpty = lrc::Array<SCALAR, DEVICE>::empty({2, 3});                                \
+		REQUIRE(testEmpty.shape() == lrc::Array<SCALAR, DEVICE>::ShapeType {2, 3});                \
+		REQUIRE(testEmpty.storage().size() == 6);                                                  \
+                                                                                                   \
 		lrc::Array<SCALAR, DEVICE> testF(testC);                                                   \
 		REQUIRE(testF.shape() == lrc::Array<SCALAR, DEVICE>::ShapeType {3, 4});                    \
 		REQUIRE(testF.storage()[0] == 5);                                                          \
@@ -557,6 +561,261 @@ namespace lrc = librapid;
 	do {                                                                                           \
 	} while (false)
 
+#define TEST_UNARY_FUNCTION(SCALAR, DEVICE, NAME_, STD_)                                           \
+	do {                                                                                           \
+		auto result = lrc::NAME_(testA).eval();                                                    \
+		bool valid	= true;                                                                        \
+		for (int64_t i = 0; i < shape[0] * shape[1]; ++i) {                                        \
+			SCALAR expected	 = static_cast<SCALAR>(STD_(testA.scalar(i)));                         \
+			SCALAR tolerance = SCALAR(1e-5) * (SCALAR(1) + std::abs(expected));                    \
+			if (std::abs(result.scalar(i) - expected) > tolerance) {                               \
+				REQUIRE(std::abs(result.scalar(i) - expected) <= tolerance);                       \
+				valid = false;                                                                     \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(valid);                                                                            \
+	} while (false)
+
+#define TEST_UNARY_FUNCTIONS(SCALAR, DEVICE)                                                       \
+	SECTION(                                                                                       \
+	  fmt::format("Test Unary Functions [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {       \
+		lrc::Array<SCALAR, DEVICE>::ShapeType shape({37, 41});                                     \
+		lrc::Array<SCALAR, DEVICE> testA(shape);                                                   \
+                                                                                                   \
+		for (int64_t i = 0; i < shape[0]; ++i) {                                                   \
+			for (int64_t j = 0; j < shape[1]; ++j) {                                               \
+				testA[i][j] = SCALAR(j + i * shape[1] + 1) / SCALAR(100);                          \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, sin, std::sin);                                        \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, cos, std::cos);                                        \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, tan, std::tan);                                        \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, tanh, std::tanh);                                      \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, exp, std::exp);                                        \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, log, std::log);                                        \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, sqrt, std::sqrt);                                      \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, abs, std::abs);                                        \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, floor, std::floor);                                    \
+		TEST_UNARY_FUNCTION(SCALAR, DEVICE, ceil, std::ceil);                                      \
+                                                                                                   \
+		/* Unary functions should compose with other lazy expressions */                           \
+		auto composed = (lrc::sqrt(testA * testA) + lrc::exp(testA)).eval();                       \
+		bool composedValid = true;                                                                 \
+		for (int64_t i = 0; i < shape[0] * shape[1]; ++i) {                                        \
+			SCALAR val		 = testA.scalar(i);                                                    \
+			SCALAR expected	 = std::sqrt(val * val) + std::exp(val);                               \
+			SCALAR tolerance = SCALAR(1e-5) * (SCALAR(1) + std::abs(expected));                    \
+			if (std::abs(composed.scalar(i) - expected) > tolerance) {                             \
+				REQUIRE(std::abs(composed.scalar(i) - expected) <= tolerance);                     \
+				composedValid = false;                                                             \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(composedValid);                                                                    \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_BROADCASTING(SCALAR, DEVICE)                                                          \
+	SECTION(                                                                                       \
+	  fmt::format("Test Broadcasting [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {          \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		lrc::Array<SCALAR, DEVICE> matrix(ShapeType({37, 41}));                                    \
+		lrc::Array<SCALAR, DEVICE> row(ShapeType({41}));                                           \
+		lrc::Array<SCALAR, DEVICE> column(ShapeType({37, 1}));                                     \
+                                                                                                   \
+		for (int64_t i = 0; i < 37; ++i) {                                                         \
+			column[i][0] = SCALAR(i + 1);                                                          \
+			for (int64_t j = 0; j < 41; ++j) { matrix[i][j] = SCALAR(j + i * 41 + 1); }            \
+		}                                                                                          \
+		for (int64_t j = 0; j < 41; ++j) { row[j] = SCALAR(j + 2); }                               \
+                                                                                                   \
+		auto rowSum = (matrix + row).eval();                                                       \
+		REQUIRE(rowSum.shape() == ShapeType({37, 41}));                                            \
+		bool rowValid = true;                                                                      \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			if (!(rowSum.scalar(i) == matrix.scalar(i) + row.scalar(i % 41))) {                    \
+				REQUIRE(rowSum.scalar(i) == matrix.scalar(i) + row.scalar(i % 41));                \
+				rowValid = false;                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(rowValid);                                                                         \
+                                                                                                   \
+		auto colProd = (matrix * column).eval();                                                   \
+		REQUIRE(colProd.shape() == ShapeType({37, 41}));                                           \
+		bool colValid = true;                                                                      \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			if (!(colProd.scalar(i) == matrix.scalar(i) * column.scalar(i / 41))) {                \
+				REQUIRE(colProd.scalar(i) == matrix.scalar(i) * column.scalar(i / 41));            \
+				colValid = false;                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(colValid);                                                                         \
+                                                                                                   \
+		auto outer = (column - row).eval();                                                        \
+		REQUIRE(outer.shape() == ShapeType({37, 41}));                                             \
+		bool outerValid = true;                                                                    \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			if (!(outer.scalar(i) == column.scalar(i / 41) - row.scalar(i % 41))) {                \
+				REQUIRE(outer.scalar(i) == column.scalar(i / 41) - row.scalar(i % 41));            \
+				outerValid = false;                                                                \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(outerValid);                                                                       \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_FUSED_MULTIPLY_ADD(SCALAR, DEVICE)                                                    \
+	SECTION(                                                                                       \
+	  fmt::format("Test Fused Multiply-Add [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {    \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		lrc::Array<SCALAR, DEVICE> testA(ShapeType({37, 41}));                                     \
+		lrc::Array<SCALAR, DEVICE> testB(ShapeType({37, 41}));                                     \
+		lrc::Array<SCALAR, DEVICE> testC(ShapeType({37, 41}));                                     \
+		lrc::Array<SCALAR, DEVICE> row(ShapeType({41}));                                           \
+                                                                                                   \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			testA.storage()[i] = SCALAR(i % 7) - SCALAR(3);                                        \
+			testB.storage()[i] = SCALAR(i % 5) + SCALAR(1);                                        \
+			testC.storage()[i] = SCALAR(i % 11);                                                   \
+		}                                                                                          \
+		for (int64_t j = 0; j < 41; ++j) { row[j] = SCALAR(j % 3); }                               \
+                                                                                                   \
+		using MultiplyAddType = decltype(testA * testB + testC);                                   \
+		using NegativeType	  = decltype(testC - testA * testB);                                   \
+		REQUIRE(std::is_same_v<typename MultiplyAddType::Functor, lrc::detail::MultiplyAdd>);      \
+		REQUIRE(std::is_same_v<typename NegativeType::Functor, lrc::detail::NegativeMultiplyAdd>); \
+                                                                                                   \
+		auto multiplyAdd	  = (testA * testB + testC).eval();                                    \
+		auto multiplySubtract = (testA * testB - testC).eval();                                    \
+		auto negative		  = (testC - testA * testB).eval();                                    \
+		auto scalarAdd		  = (testA * SCALAR(2) + row).eval();                                  \
+		auto addScalar		  = (SCALAR(3) + testA * testB).eval();                                \
+		REQUIRE(scalarAdd.shape() == ShapeType({37, 41}));                                         \
+                                                                                                   \
+		bool valid = true;                                                                         \
+		for (int64_t i = 0; i < 37 * 41; ++i) {                                                    \
+			const SCALAR a = testA.scalar(i), b = testB.scalar(i), c = testC.scalar(i);            \
+			const SCALAR r = row.scalar(i % 41);                                                   \
+			if (multiplyAdd.scalar(i) != a * b + c || multiplySubtract.scalar(i) != a * b - c ||   \
+				negative.scalar(i) != c - a * b || scalarAdd.scalar(i) != a * SCALAR(2) + r ||     \
+				addScalar.scalar(i) != SCALAR(3) + a * b) {                                        \
+				REQUIRE(multiplyAdd.scalar(i) == a * b + c);                                       \
+				REQUIRE(multiplySubtract.scalar(i) == a * b - c);                                  \
+				REQUIRE(negative.scalar(i) == c - a * b);                                          \
+				REQUIRE(scalarAdd.scalar(i) == a * SCALAR(2) + r);                                 \
+				REQUIRE(addScalar.scalar(i) == SCALAR(3) + a * b);                                 \
+				valid = false;                                                                     \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(valid);                                                                            \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_COMPOUND_ASSIGNMENT(SCALAR, DEVICE)                                                   \
+	SECTION(                                                                                       \
+	  fmt::format("Test Compound Assignment [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {   \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		/* Sizes either side of the multithreading threshold */                                    \
+		for (int rows : {37, 1021}) {                                                              \
+			lrc::Array<SCALAR, DEVICE> testA(ShapeType({rows, 41}));                               \
+			lrc::Array<SCALAR, DEVICE> testB(ShapeType({rows, 41}));                               \
+			lrc::Array<SCALAR, DEVICE> row(ShapeType({41}));                                       \
+                                                                                                   \
+			for (int64_t i = 0; i < rows * 41; ++i) {                                              \
+				testA.storage()[i] = SCALAR(i % 13) + SCALAR(1);                                   \
+				testB.storage()[i] = SCALAR(i % 7) + SCALAR(1);                                    \
+			}                                                                                      \
+			for (int64_t j = 0; j < 41; ++j) { row[j] = SCALAR(j % 3) + SCALAR(1); }               \
+                                                                                                   \
+			lrc::Array<SCALAR, DEVICE> result = testA;                                             \
+			const auto *data				  = result.storage().begin();                          \
+			result += testB;                                                                       \
+			result *= row;                                                                         \
+			result -= testA * testB;                                                               \
+			result /= SCALAR(2);                                                                   \
+			result += SCALAR(1);                                                                   \
+                                                                                                   \
+			/* The operation is in-place, so the storage must not be reallocated */                \
+			REQUIRE(result.storage().begin() == data);                                             \
+			REQUIRE(result.shape() == ShapeType({rows, 41}));                                      \
+                                                                                                   \
+			bool valid = true;                                                                     \
+			for (int64_t i = 0; i < rows * 41; ++i) {                                              \
+				const SCALAR a = testA.scalar(i), b = testB.scalar(i), r = row.scalar(i % 41);     \
+				const SCALAR expected = ((a + b) * r - a * b) / SCALAR(2) + SCALAR(1);             \
+				if (result.scalar(i) != expected) {                                                \
+					REQUIRE(result.scalar(i) == expected);                                         \
+					valid = false;                                                                 \
+				}                                                                                  \
+			}                                                                                      \
+			REQUIRE(valid);                                                                        \
+		}                                                                                          \
+                                                                                                   \
+		/* Operands which read the array other than element for element see the old values */      \
+		lrc::Array<SCALAR, DEVICE> square(ShapeType({41, 41}));                                    \
+		for (int64_t i = 0; i < 41 * 41; ++i) { square.storage()[i] = SCALAR(i % 11); }            \
+		lrc::Array<SCALAR, DEVICE> original = square;                                              \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> broadcast = square;                                             \
+		broadcast += broadcast[0];                                                                 \
+		square += lrc::transpose(square);                                                          \
+                                                                                                   \
+		bool valid = true;                                                                         \
+		for (int64_t i = 0; i < 41; ++i) {                                                         \
+			for (int64_t j = 0; j < 41; ++j) {                                                     \
+				const SCALAR value = original.scalar(i * 41 + j);                                  \
+				valid = valid && broadcast.scalar(i * 41 + j) == value + original.scalar(j) &&     \
+						square.scalar(i * 41 + j) == value + original.scalar(j * 41 + i);          \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(valid);                                                                            \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_STRIDED_VIEWS(SCALAR, DEVICE)                                                         \
+	SECTION(fmt::format("Test Strided Views [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {   \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		lrc::Array<SCALAR, DEVICE> testA(ShapeType({3, 5, 7, 23}));                                \
+		for (int64_t i = 0; i < 3 * 5 * 7 * 23; ++i) { testA.storage()[i] = SCALAR(i % 127); }     \
+                                                                                                   \
+		/* Views of every element, and of every other (strided) element, of the inner dimension */ \
+		for (int step : {1, 2}) {                                                                  \
+			auto view	= lrc::array::ArrayView(testA);                                            \
+			auto stride = view.stride();                                                           \
+			stride[3] *= step;                                                                     \
+			view.setShape(ShapeType({3, 5, 7, 23 / step}));                                        \
+			view.setStride(stride);                                                                \
+                                                                                                   \
+			const int inner		= 23 / step;                                                       \
+			auto evaluated		= view.eval();                                                     \
+			lrc::Array<SCALAR, DEVICE> sum(ShapeType({3, 5, 7, inner}));                           \
+			sum = view + evaluated;                                                                \
+			auto sub = view[2][3];                                                                 \
+                                                                                                   \
+			bool valid = true;                                                                     \
+			for (int64_t i = 0; i < 3 * 5 * 7 * inner; ++i) {                                      \
+				const SCALAR expected = testA.scalar((i / inner) * 23 + (i % inner) * step);       \
+				if (evaluated.scalar(i) != expected || view.scalar(i) != expected ||               \
+					sum.scalar(i) != expected + expected) {                                        \
+					REQUIRE(evaluated.scalar(i) == expected);                                      \
+					REQUIRE(view.scalar(i) == expected);                                           \
+					REQUIRE(sum.scalar(i) == expected + expected);                                 \
+					valid = false;                                                                 \
+				}                                                                                  \
+			}                                                                                      \
+			REQUIRE(valid);                                                                        \
+                                                                                                   \
+			REQUIRE(sub.shape() == ShapeType({7, inner}));                                         \
+			REQUIRE(sub.scalar(inner + 1) == testA.scalar(((2 * 5 + 3) * 7 + 1) * 23 + step));     \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
 #define TEST_ALL(SCALAR, DEVICE)                                                                   \
 	TEST_CONSTRUCTORS(SCALAR, DEVICE);                                                             \
 	TEST_INDEXING(SCALAR, DEVICE);                                                                 \
@@ -594,12 +853,294 @@ TEST_CASE("Test Array -- uint16_t CPU", "[array-lib]") {
 	TEST_STRING_FORMATTING(uint16_t, lrc::device::CPU);
 }
 
-TEST_CASE("Test Array -- int32_t CPU", "[array-lib]") { TEST_ALL(int32_t, lrc::device::CPU); }
+TEST_CASE("Test Array -- int32_t CPU", "[array-lib]") {
+	TEST_ALL(int32_t, lrc::device::CPU);
+	TEST_COMPOUND_ASSIGNMENT(int32_t, lrc::device::CPU);
+	TEST_STRIDED_VIEWS(int32_t, lrc::device::CPU);
+}
+
 TEST_CASE("Test Array -- uint32_t CPU", "[array-lib]") { TEST_ALL(uint32_t, lrc::device::CPU); }
 TEST_CASE("Test Array -- int64_t CPU", "[array-lib]") { TEST_ALL(int64_t, lrc::device::CPU); }
 TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") { TEST_ALL(uint64_t, lrc::device::CPU); }
-TEST_CASE("Test Array -- float CPU", "[array-lib]") { TEST_ALL(float, lrc::device::CPU); }
-TEST_CASE("Test Array -- double CPU", "[array-lib]") { TEST_ALL(double, lrc::device::CPU); }
+TEST_CASE("Test Array -- float CPU", "[array-lib]") {
+	TEST_ALL(float, lrc::device::CPU);
+	TEST_UNARY_FUNCTIONS(float, lrc::device::CPU);
+	TEST_BROADCASTING(float, lrc::device::CPU);
+	TEST_FUSED_MULTIPLY_ADD(float, lrc::device::CPU);
+	TEST_COMPOUND_ASSIGNMENT(float, lrc::device::CPU);
+	TEST_STRIDED_VIEWS(float, lrc::device::CPU);
+}
+
+TEST_CASE("Test Array -- double CPU", "[array-lib]") {
+	TEST_ALL(double, lrc::device::CPU);
+	TEST_UNARY_FUNCTIONS(double, lrc::device::CPU);
+	TEST_BROADCASTING(double, lrc::device::CPU);
+	TEST_FUSED_MULTIPLY_ADD(double, lrc::device::CPU);
+	TEST_COMPOUND_ASSIGNMENT(double, lrc::device::CPU);
+	TEST_STRIDED_VIEWS(double, lrc::device::CPU);
+}
+
+TEST_CASE("Test Array -- Mixed Scalar Types CPU", "[array-lib]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	lrc::Array<float> testF(ShapeType({37, 41}));
+	lrc::Array<int32_t> testI(ShapeType({37, 41}));
+	lrc::Array<int16_t> testS(ShapeType({37, 41}));
+	lrc::Array<double> row(ShapeType({41}));
+
+	for (int64_t i = 0; i < 37 * 41; ++i) {
+		testF.storage()[i] = float(i % 101) * 0.5f;
+		testI.storage()[i] = int32_t(i % 17) - 8;
+		testS.storage()[i] = int16_t(i % 23);
+	}
+	for (int64_t j = 0; j < 41; ++j) { row[j] = double(j) * 0.25; }
+
+	// Expressions which do not promote, and each of these which promotes its arguments, must
+	// remain on the vectorised path
+	REQUIRE(lrc::typetraits::TypeInfo<decltype(testF + testF)>::allowVectorisation);
+	REQUIRE(lrc::typetraits::TypeInfo<decltype(testI * testI)>::allowVectorisation);
+	REQUIRE(lrc::typetraits::TypeInfo<decltype(testF * 2.0)>::allowVectorisation);
+	REQUIRE(lrc::typetraits::TypeInfo<decltype(testI + testF)>::allowVectorisation);
+	REQUIRE(lrc::typetraits::TypeInfo<decltype(testS + testI)>::allowVectorisation);
+	REQUIRE(lrc::typetraits::TypeInfo<decltype(lrc::sin(testI))>::allowVectorisation);
+
+	// Vc cannot convert these Packets, so they are evaluated with scalar operations
+	lrc::Array<int8_t> testC(ShapeType({37, 41}));
+	lrc::Array<int64_t> testL(ShapeType({37, 41}));
+	for (int64_t i = 0; i < 37 * 41; ++i) {
+		testC.storage()[i] = int8_t(i % 29) - 14;
+		testL.storage()[i] = int64_t(i) * 3;
+	}
+	REQUIRE_FALSE(lrc::typetraits::TypeInfo<decltype(testC * 2.0)>::allowVectorisation);
+	REQUIRE_FALSE(lrc::typetraits::TypeInfo<decltype(testL + testF)>::allowVectorisation);
+	auto charDouble = (testC * 2.0).eval();
+	auto longFloat	= (testL + testF).eval();
+	REQUIRE(std::is_same_v<decltype(longFloat)::Scalar, float>);
+	for (int64_t i = 0; i < 37 * 41; ++i) {
+		if (charDouble.scalar(i) != testC.scalar(i) * 2.0 ||
+			longFloat.scalar(i) != static_cast<float>(testL.scalar(i)) + testF.scalar(i)) {
+			REQUIRE(charDouble.scalar(i) == testC.scalar(i) * 2.0);
+			REQUIRE(longFloat.scalar(i) == static_cast<float>(testL.scalar(i)) + testF.scalar(i));
+		}
+	}
+
+	auto floatDouble = (testF * 2.0).eval();
+	auto intFloat	 = (testI + testF).eval();
+	auto shortInt	 = (testS + testI).eval();
+	auto broadcast	 = ((testF + testI) * row).eval();
+	auto sinInt		 = lrc::sin(testI).eval();
+
+	REQUIRE(std::is_same_v<decltype(floatDouble)::Scalar, double>);
+	REQUIRE(std::is_same_v<decltype(intFloat)::Scalar, float>);
+	REQUIRE(std::is_same_v<decltype(shortInt)::Scalar, int32_t>);
+
+	bool valid = true;
+	for (int64_t i = 0; i < 37 * 41; ++i) {
+		const float f		  = testF.scalar(i);
+		const int32_t n		  = testI.scalar(i);
+		const int16_t s		  = testS.scalar(i);
+		const double r		  = row.scalar(i % 41);
+		const double sinError = std::abs(sinInt.scalar(i) - std::sin(n));
+		if (floatDouble.scalar(i) != f * 2.0 || intFloat.scalar(i) != n + f ||
+			shortInt.scalar(i) != s + n || broadcast.scalar(i) != (f + n) * r || sinError > 1e-12) {
+			REQUIRE(floatDouble.scalar(i) == f * 2.0);
+			REQUIRE(intFloat.scalar(i) == n + f);
+			REQUIRE(shortInt.scalar(i) == s + n);
+			REQUIRE(broadcast.scalar(i) == (f + n) * r);
+			REQUIRE(sinError <= 1e-12);
+			valid = false;
+		}
+	}
+	REQUIRE(valid);
+}
+
+// Arithmetic on small integer types promotes to int, so compound assignment converts back
+TEST_CASE("Test Array -- Compound Assignment Promotion CPU", "[array-lib]") {
+	auto check = [](auto zero) {
+		using Scalar	= decltype(zero);
+		using ShapeType = typename lrc::Array<Scalar>::ShapeType;
+
+		lrc::Array<Scalar> testA(ShapeType({37, 41}));
+		lrc::Array<Scalar> testB(ShapeType({37, 41}));
+		for (int64_t i = 0; i < 37 * 41; ++i) {
+			testA.storage()[i] = Scalar(i % 5 + 10);
+			testB.storage()[i] = Scalar(i % 3 + 1);
+		}
+
+		lrc::Array<Scalar> result = testA;
+		result += testB;
+		result *= Scalar(2);
+		result -= testB;
+		result /= testB;
+		result += result[0];
+
+		bool valid = true;
+		for (int64_t i = 0; i < 37 * 41; ++i) {
+			const auto row = [&](int64_t index) {
+				return ((testA.scalar(index) + testB.scalar(index)) * 2 - testB.scalar(index)) /
+					   testB.scalar(index);
+			};
+			valid = valid && result.scalar(i) == Scalar(row(i) + row(i % 41));
+		}
+		REQUIRE(valid);
+	};
+
+	check(int8_t(0));
+	check(uint8_t(0));
+	check(int16_t(0));
+	check(uint16_t(0));
+}
+
+TEST_CASE("Test Array -- Aligned Loads CPU", "[array-lib]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	lrc::Array<float> testA(ShapeType({37, 41}));
+	lrc::Array<float> testB(ShapeType({37, 41}));
+	lrc::Array<float> testC(ShapeType({37, 41}));
+	for (int64_t i = 0; i < 37 * 41; ++i) {
+		testA.storage()[i] = float(i % 19) * 0.5f;
+		testB.storage()[i] = float(i % 7) - 3.0f;
+	}
+
+	// Arrays allocated by LibRapid share an alignment, so they are read with aligned loads
+	REQUIRE((testA * 2 + testB).packetIsAligned(0));
+
+	// Rows of 41 elements start at different offsets from a packet boundary, so reading them
+	// into an aligned destination falls back to unaligned loads
+	constexpr int64_t packetWidth = lrc::typetraits::TypeInfo<float>::packetWidth;
+	if (packetWidth > 1) REQUIRE_FALSE((testA[1] + testB[2]).packetIsAligned(0));
+	lrc::Array<float> rows = testA[1] + testB[2];
+
+	// Rows at the same offset are aligned again once the destination's head is peeled
+	testC[3] = testA[3] * testB[3] + testA[3];
+
+	bool valid = true;
+	for (int64_t j = 0; j < 41; ++j) {
+		const float a1 = testA.scalar(41 + j), b2 = testB.scalar(82 + j);
+		const float a3 = testA.scalar(123 + j), b3 = testB.scalar(123 + j);
+		valid = valid && rows.scalar(j) == a1 + b2 && testC.scalar(123 + j) == a3 * b3 + a3;
+	}
+	REQUIRE(valid);
+}
+
+TEST_CASE("Test Array -- Uninitialized Construction CPU", "[array-lib]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	const int64_t prevThreshold = lrc::global::multithreadThreshold;
+	const int64_t prevThreads	= lrc::global::numThreads;
+	lrc::global::multithreadThreshold = 1000;
+	lrc::global::numThreads			  = 4;
+
+	auto empty = lrc::Array<double>::empty(ShapeType({50, 60}));
+	REQUIRE(empty.shape() == ShapeType({50, 60}));
+	REQUIRE(empty.storage().size() == 3000);
+
+	// Large fills run in parallel
+	lrc::Array<double> filled(ShapeType({50, 60}), 1.5);
+	bool valid = true;
+	for (int64_t i = 0; i < 3000; ++i) valid = valid && filled.scalar(i) == 1.5;
+	REQUIRE(valid);
+
+	// Assigning an expression of a different shape replaces both the shape and the storage
+	lrc::Array<double> small(ShapeType({3}), 2);
+	small = filled + filled;
+	REQUIRE(small.shape() == ShapeType({50, 60}));
+	for (int64_t i = 0; i < 3000; ++i) valid = valid && small.scalar(i) == 3;
+	REQUIRE(valid);
+
+	lrc::global::multithreadThreshold = prevThreshold;
+	lrc::global::numThreads			  = prevThreads;
+}
+
+TEST_CASE("Test Array -- Summarised String Formatting CPU", "[array-lib]") {
+	using ShapeType = lrc::Array<int64_t>::ShapeType;
+
+	lrc::Array<int64_t> vector(ShapeType({2000}));
+	for (int64_t i = 0; i < 2000; ++i) vector.storage()[i] = i;
+	REQUIRE(vector.str() == "[0 1 2 ... 1997 1998 1999]");
+
+	// Expressions are formatted without evaluating the elements which are not printed
+	REQUIRE((vector + vector).str() == "[0 2 4 ... 3994 3996 3998]");
+
+	lrc::Array<int64_t> matrix(ShapeType({100, 100}));
+	for (int64_t i = 0; i < 10000; ++i) matrix.storage()[i] = i;
+	REQUIRE(matrix.str() == "[[   0    1    2 ...   97   98   99]\n"
+							" [ 100  101  102 ...  197  198  199]\n"
+							" [ 200  201  202 ...  297  298  299]\n"
+							" ...\n"
+							" [9700 9701 9702 ... 9797 9798 9799]\n"
+							" [9800 9801 9802 ... 9897 9898 9899]\n"
+							" [9900 9901 9902 ... 9997 9998 9999]]");
+
+	// Transpositions and products are formatted lazily too, and match their evaluated results
+	auto transposed = lrc::transpose(matrix);
+	auto product	= lrc::matmul(matrix, matrix);
+	REQUIRE(transposed.str() == lrc::Array<int64_t>(transposed).str());
+	REQUIRE(product.str() == lrc::Array<int64_t>(product).str());
+
+	// Arrays at or below the threshold are printed in full
+	const int64_t prevThreshold = lrc::global::printThreshold;
+	const int64_t prevEdgeItems = lrc::global::printEdgeItems;
+	lrc::global::printThreshold = 2000;
+	REQUIRE(vector.str().find("...") == std::string::npos);
+
+	lrc::global::printThreshold = 10;
+	lrc::global::printEdgeItems = 1;
+	REQUIRE(vector.str() == "[0 ... 1999]");
+
+	lrc::global::printThreshold = prevThreshold;
+	lrc::global::printEdgeItems = prevEdgeItems;
+}
+
+#	if defined(LIBRAPID_LINUX) || defined(LIBRAPID_APPLE)
+TEST_CASE("Test Array -- fromCSV CPU", "[array-lib]") {
+	using ShapeType		   = lrc::Array<double>::ShapeType;
+	const std::string path = "test-array-csv.csv";
+
+	{
+		std::ofstream file(path);
+		file << "a, b, c\n1, 2.5, -3\r\n\n# A comment\n+4,5e2,6\n";
+	}
+
+	lrc::CSVOptions options;
+	options.skipRows = 1;
+	auto small		 = lrc::Array<double>::fromCSV(path, options);
+	REQUIRE(small.shape() == ShapeType({2, 3}));
+	REQUIRE(small.scalar(0) == 1);
+	REQUIRE(small.scalar(1) == 2.5);
+	REQUIRE(small.scalar(2) == -3);
+	REQUIRE(small.scalar(3) == 4);
+	REQUIRE(small.scalar(4) == 500);
+	REQUIRE(small.scalar(5) == 6);
+
+	// Without skipping the titles, they cannot be parsed
+	REQUIRE_THROWS(lrc::Array<double>::fromCSV(path));
+
+	// Large files are split between threads
+	{
+		std::ofstream file(path);
+		file << "# rows of i, 2i, 3i\n";
+		for (int64_t i = 0; i < 100000; ++i) file << i << ';' << i * 2 << ';' << i * 3 << '\n';
+	}
+
+	options.delimiter = ';';
+	options.skipRows  = 0;
+	auto large		  = lrc::Array<int64_t>::fromCSV(path, options);
+	REQUIRE(large.shape() == ShapeType({100000, 3}));
+	bool valid = true;
+	for (int64_t i = 0; i < 100000; ++i) {
+		valid = valid && large.scalar(i * 3) == i && large.scalar(i * 3 + 1) == i * 2 &&
+				large.scalar(i * 3 + 2) == i * 3;
+	}
+	REQUIRE(valid);
+
+	// Rows must all have the same number of values
+	{
+		std::ofstream file(path);
+		file << "1,2\n3,4\n5\n";
+	}
+	REQUIRE_THROWS(lrc::Array<float>::fromCSV(path));
+	std::remove(path.c_str());
+}
+#	endif // LIBRAPID_LINUX || LIBRAPID_APPLE
 
 #	if defined(LIBRAPID_USE_MULTIPREC)
 TEST_CASE("Test Array -- lrc::mpfr CPU", "[array-lib]") { TEST_ALL(lrc::mpfr, lrc::device::CPU); }
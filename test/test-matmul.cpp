@@ -0,0 +1,462 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+// Multiply an M x K matrix by a K x N matrix with a naive loop. Either operand may be stored
+// transposed, in which case element (i, j) is read from (j, i).
+template<typename Scalar>
+std::vector<Scalar> referenceMatmul(const Scalar *a, const Scalar *b, int64_t m, int64_t n,
+									int64_t k, bool transA = false, bool transB = false) {
+	std::vector<Scalar> res(m * n, Scalar(0));
+	for (int64_t i = 0; i < m; ++i) {
+		for (int64_t j = 0; j < n; ++j) {
+			Scalar sum(0);
+			for (int64_t p = 0; p < k; ++p) {
+				const Scalar lhs = transA ? a[p * m + i] : a[i * k + p];
+				const Scalar rhs = transB ? b[j * k + p] : b[p * n + j];
+				sum += lhs * rhs;
+			}
+			res[i * n + j] = sum;
+		}
+	}
+	return res;
+}
+
+// Check a stack of M x N matrices against referenceMatmul. offsets(i) returns the indices of the
+// matrices in A and B which are multiplied to give matrix i of the result.
+template<typename Scalar, typename Offsets>
+bool matchesBatched(const Scalar *c, const Scalar *a, const Scalar *b, int64_t batch, int64_t m,
+					int64_t n, int64_t k, Offsets &&offsets, bool transB = false) {
+	for (int64_t i = 0; i < batch; ++i) {
+		const auto [aIndex, bIndex] = offsets(i);
+		const auto expected =
+		  referenceMatmul(a + aIndex * m * k, b + bIndex * k * n, m, n, k, false, transB);
+		for (int64_t j = 0; j < m * n; ++j) {
+			if (c[i * m * n + j] != expected[j]) return false;
+		}
+	}
+	return true;
+}
+
+#define TEST_MATMUL(SCALAR, DEVICE)                                                                \
+	SECTION(fmt::format("Test Matmul [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {          \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		/* Small values keep the results exact for floating point types */                         \
+		auto fill = [](auto &array, int64_t seed) {                                                \
+			for (int64_t i = 0; i < int64_t(array.shape().size()); ++i) {                          \
+				array.storage()[i] = SCALAR((i * seed) % 7) - SCALAR(3);                           \
+			}                                                                                      \
+		};                                                                                         \
+		auto matches = [](const auto &result, const std::vector<SCALAR> &expected) {               \
+			for (size_t i = 0; i < expected.size(); ++i) {                                         \
+				if (result.storage()[i] != expected[i]) return false;                              \
+			}                                                                                      \
+			return true;                                                                           \
+		};                                                                                         \
+                                                                                                   \
+		/* Sizes either side of the multithreading threshold */                                    \
+		for (auto [m, n, k] : std::vector<std::array<int64_t, 3>>(                                 \
+			   {{1, 1, 1}, {3, 5, 7}, {17, 1, 33}, {64, 48, 80}, {150, 130, 90}})) {               \
+			lrc::Array<SCALAR, DEVICE> a(ShapeType({size_t(m), size_t(k)}));                       \
+			lrc::Array<SCALAR, DEVICE> b(ShapeType({size_t(k), size_t(n)}));                       \
+			fill(a, 3);                                                                            \
+			fill(b, 5);                                                                            \
+                                                                                                   \
+			lrc::Array<SCALAR, DEVICE> c = lrc::matmul(a, b);                                      \
+			REQUIRE(c.shape() == ShapeType({size_t(m), size_t(n)}));                               \
+			REQUIRE(matches(                                                                       \
+			  c, referenceMatmul(a.storage().begin(), b.storage().begin(), m, n, k)));             \
+                                                                                                   \
+			/* Transposed operands are passed to gemm without being copied */                      \
+			lrc::Array<SCALAR, DEVICE> at(ShapeType({size_t(k), size_t(m)}));                      \
+			lrc::Array<SCALAR, DEVICE> bt(ShapeType({size_t(n), size_t(k)}));                      \
+			fill(at, 2);                                                                           \
+			fill(bt, 3);                                                                           \
+			lrc::Array<SCALAR, DEVICE> ct = lrc::matmul(lrc::transpose(at), lrc::transpose(bt));   \
+			REQUIRE(matches(ct,                                                                    \
+							referenceMatmul(                                                       \
+							  at.storage().begin(), bt.storage().begin(), m, n, k, true, true)));  \
+                                                                                                   \
+			/* Expression operands are evaluated first */                                          \
+			lrc::Array<SCALAR, DEVICE> sum	 = a + a;                                              \
+			lrc::Array<SCALAR, DEVICE> cExpr = lrc::matmul(a + a, b);                              \
+			REQUIRE(matches(                                                                       \
+			  cExpr, referenceMatmul(sum.storage().begin(), b.storage().begin(), m, n, k)));       \
+		}                                                                                          \
+                                                                                                   \
+		/* Vector operands */                                                                      \
+		lrc::Array<SCALAR, DEVICE> matrix(ShapeType({4, 3}));                                      \
+		lrc::Array<SCALAR, DEVICE> vec3(ShapeType({3}));                                           \
+		lrc::Array<SCALAR, DEVICE> vec4(ShapeType({4}));                                           \
+		fill(matrix, 1);                                                                           \
+		fill(vec3, 2);                                                                             \
+		fill(vec4, 4);                                                                             \
+		const SCALAR *mat = matrix.storage().begin();                                              \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> mv = lrc::matmul(matrix, vec3);                                 \
+		REQUIRE(mv.shape() == ShapeType({4}));                                                     \
+		REQUIRE(matches(mv, referenceMatmul(mat, vec3.storage().begin(), 4, 1, 3)));               \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> vm = lrc::matmul(vec4, matrix);                                 \
+		REQUIRE(vm.shape() == ShapeType({3}));                                                     \
+		REQUIRE(matches(vm, referenceMatmul(vec4.storage().begin(), mat, 1, 3, 4)));               \
+                                                                                                   \
+		auto dot = lrc::matmul(vec3, vec3).eval();                                                 \
+		REQUIRE(dot.shape().ndim() == 0);                                                          \
+		REQUIRE(dot.scalar(0) ==                                                                   \
+				referenceMatmul(vec3.storage().begin(), vec3.storage().begin(), 1, 1, 3)[0]);      \
+                                                                                                   \
+		/* Element access computes individual dot products */                                     \
+		auto lazy = lrc::matmul(matrix, lrc::transpose(matrix));                                   \
+		REQUIRE(lazy.shape() == ShapeType({4, 4}));                                                \
+		REQUIRE(lazy.scalar(6) == lazy.eval().scalar(6));                                          \
+                                                                                                   \
+		/* Stacks of matrices, with the batch dimensions broadcast between the operands */         \
+		lrc::Array<SCALAR, DEVICE> stackA(ShapeType({5, 3, 4}));                                   \
+		lrc::Array<SCALAR, DEVICE> stackB(ShapeType({5, 4, 6}));                                   \
+		lrc::Array<SCALAR, DEVICE> stackBt(ShapeType({5, 6, 4}));                                  \
+		lrc::Array<SCALAR, DEVICE> pairA(ShapeType({2, 1, 3, 4}));                                 \
+		fill(stackA, 3);                                                                           \
+		fill(stackB, 5);                                                                           \
+		fill(stackBt, 2);                                                                          \
+		fill(pairA, 4);                                                                            \
+		const SCALAR *sa = stackA.storage().begin(), *sb = stackB.storage().begin();               \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> batched = lrc::matmul(stackA, stackB);                          \
+		REQUIRE(batched.shape() == ShapeType({5, 3, 6}));                                          \
+		REQUIRE(matchesBatched(batched.storage().begin(), sa, sb, 5, 3, 6, 4, [](int64_t i) {      \
+			return std::make_pair(i, i);                                                           \
+		}));                                                                                       \
+		REQUIRE(batched.scalar(50) == lrc::matmul(stackA, stackB).scalar(50));                     \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> shared = lrc::matmul(stackA[0], stackB);                        \
+		REQUIRE(shared.shape() == ShapeType({5, 3, 6}));                                           \
+		REQUIRE(matchesBatched(shared.storage().begin(), sa, sb, 5, 3, 6, 4, [](int64_t i) {       \
+			return std::make_pair(int64_t(0), i);                                                  \
+		}));                                                                                       \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> outer = lrc::matmul(pairA, stackB);                             \
+		REQUIRE(outer.shape() == ShapeType({2, 5, 3, 6}));                                         \
+		REQUIRE(matchesBatched(outer.storage().begin(),                                            \
+							   pairA.storage().begin(),                                            \
+							   sb,                                                                 \
+							   10,                                                                 \
+							   3,                                                                  \
+							   6,                                                                  \
+							   4,                                                                  \
+							   [](int64_t i) { return std::make_pair(i / 5, i % 5); }));           \
+		REQUIRE(outer.scalar(100) == lrc::matmul(pairA, stackB).scalar(100));                      \
+                                                                                                   \
+		lrc::Array<SCALAR, DEVICE> stackT =                                                        \
+		  lrc::matmul(stackA, lrc::transpose(stackBt, {0, 2, 1}));                                 \
+		REQUIRE(matchesBatched(stackT.storage().begin(),                                           \
+							   sa,                                                                 \
+							   stackBt.storage().begin(),                                          \
+							   5,                                                                  \
+							   3,                                                                  \
+							   6,                                                                  \
+							   4,                                                                  \
+							   [](int64_t i) { return std::make_pair(i, i); },                     \
+							   true));                                                             \
+                                                                                                   \
+		/* Many small matrices are distributed between threads */                                 \
+		lrc::Array<SCALAR, DEVICE> manyA(ShapeType({500, 8, 7}));                                  \
+		lrc::Array<SCALAR, DEVICE> manyB(ShapeType({500, 7, 9}));                                  \
+		fill(manyA, 3);                                                                            \
+		fill(manyB, 2);                                                                            \
+		lrc::Array<SCALAR, DEVICE> many = lrc::matmul(manyA, manyB);                               \
+		REQUIRE(matchesBatched(many.storage().begin(),                                             \
+							   manyA.storage().begin(),                                            \
+							   manyB.storage().begin(),                                            \
+							   500,                                                                \
+							   8,                                                                  \
+							   9,                                                                  \
+							   7,                                                                  \
+							   [](int64_t i) { return std::make_pair(i, i); }));                   \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Matmul -- int32_t CPU", "[matmul]") { TEST_MATMUL(int32_t, lrc::device::CPU); }
+
+TEST_CASE("Test Matmul -- float CPU", "[matmul]") { TEST_MATMUL(float, lrc::device::CPU); }
+
+TEST_CASE("Test Matmul -- double CPU", "[matmul]") { TEST_MATMUL(double, lrc::device::CPU); }
+
+// Assigning a product to one of its own operands must not overwrite the operand while the GEMM is
+// still reading it, or free it when the result has a different shape
+#define TEST_MATMUL_ALIASING(SCALAR, DEVICE)                                                       \
+	SECTION(fmt::format(                                                                           \
+	  "Test Matmul Aliasing [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {                   \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		auto fill = [](auto &array, int64_t seed) {                                                \
+			for (int64_t i = 0; i < int64_t(array.shape().size()); ++i) {                          \
+				array.storage()[i] = SCALAR((i * seed) % 7) - SCALAR(3);                           \
+			}                                                                                      \
+		};                                                                                         \
+		auto matches = [](const auto &result, const std::vector<SCALAR> &expected) {               \
+			for (size_t i = 0; i < expected.size(); ++i) {                                         \
+				if (result.storage()[i] != expected[i]) return false;                              \
+			}                                                                                      \
+			return true;                                                                           \
+		};                                                                                         \
+                                                                                                   \
+		for (auto [m, n, k] : std::vector<std::array<int64_t, 3>>(                                 \
+			   {{4, 4, 4}, {5, 7, 4}, {64, 64, 64}, {150, 90, 130}})) {                            \
+			lrc::Array<SCALAR, DEVICE> a(ShapeType({size_t(m), size_t(k)}));                       \
+			lrc::Array<SCALAR, DEVICE> b(ShapeType({size_t(k), size_t(n)}));                       \
+			fill(a, 3);                                                                            \
+			fill(b, 5);                                                                            \
+			const auto expected =                                                                  \
+			  referenceMatmul(a.storage().begin(), b.storage().begin(), m, n, k);                  \
+                                                                                                   \
+			/* The result has the shape of a (square b) or replaces it (non-square b) */           \
+			lrc::Array<SCALAR, DEVICE> lhs = a;                                                    \
+			lhs							   = lrc::matmul(lhs, b);                                  \
+			REQUIRE(lhs.shape() == ShapeType({size_t(m), size_t(n)}));                             \
+			REQUIRE(matches(lhs, expected));                                                       \
+                                                                                                   \
+			/* The destination is the right operand */                                             \
+			if (m == k) {                                                                          \
+				lrc::Array<SCALAR, DEVICE> rhs = b;                                                \
+				rhs							   = lrc::matmul(a, rhs);                              \
+				REQUIRE(matches(rhs, expected));                                                   \
+			}                                                                                      \
+                                                                                                   \
+			/* The destination is read through a transposition */                                  \
+			if (m == k) {                                                                          \
+				lrc::Array<SCALAR, DEVICE> at = lrc::transpose(a);                                 \
+				at							  = lrc::matmul(lrc::transpose(at), b);                \
+				REQUIRE(matches(at, expected));                                                    \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* The destination is a sub-array of the left operand */                                   \
+		lrc::Array<SCALAR, DEVICE> stack(ShapeType({3, 4, 4}));                                    \
+		lrc::Array<SCALAR, DEVICE> square(ShapeType({4, 4}));                                      \
+		fill(stack, 3);                                                                            \
+		fill(square, 5);                                                                           \
+		const auto expectedRow =                                                                   \
+		  referenceMatmul(stack.storage().begin(), square.storage().begin(), 4, 4, 4);             \
+		stack[0] = lrc::matmul(stack[0], square);                                                  \
+		REQUIRE(matches(stack[0], expectedRow));                                                   \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Matmul Aliasing -- int32_t CPU", "[matmul]") {
+	TEST_MATMUL_ALIASING(int32_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Matmul Aliasing -- float CPU", "[matmul]") {
+	TEST_MATMUL_ALIASING(float, lrc::device::CPU);
+}
+
+TEST_CASE("Test Matmul Aliasing -- double CPU", "[matmul]") {
+	TEST_MATMUL_ALIASING(double, lrc::device::CPU);
+}
+
+// Element-wise operations on the result of a matrix multiplication are applied to each tile of
+// the product as the GEMM's epilogue
+#define TEST_MATMUL_EPILOGUE(SCALAR, DEVICE)                                                       \
+	SECTION(fmt::format(                                                                           \
+	  "Test Matmul Epilogue [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {                   \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		auto fill = [](auto &array, int64_t seed) {                                                \
+			for (int64_t i = 0; i < int64_t(array.shape().size()); ++i) {                          \
+				array.storage()[i] = SCALAR((i * seed) % 7) - SCALAR(3);                           \
+			}                                                                                      \
+		};                                                                                         \
+                                                                                                   \
+		for (auto [m, n, k] : std::vector<std::array<int64_t, 3>>(                                 \
+			   {{3, 5, 7}, {17, 1, 33}, {64, 48, 80}, {150, 130, 90}, {37, 41, 300}})) {           \
+			lrc::Array<SCALAR, DEVICE> a(ShapeType({size_t(m), size_t(k)}));                       \
+			lrc::Array<SCALAR, DEVICE> b(ShapeType({size_t(k), size_t(n)}));                       \
+			lrc::Array<SCALAR, DEVICE> bias(ShapeType({size_t(n)}));                               \
+			lrc::Array<SCALAR, DEVICE> other(ShapeType({size_t(m), size_t(n)}));                   \
+			fill(a, 3);                                                                            \
+			fill(b, 5);                                                                            \
+			fill(bias, 2);                                                                         \
+			fill(other, 4);                                                                        \
+			const auto product =                                                                   \
+			  referenceMatmul(a.storage().begin(), b.storage().begin(), m, n, k);                  \
+                                                                                                   \
+			auto check = [&](const auto &result, auto &&op) {                                      \
+				REQUIRE(result.shape() == ShapeType({size_t(m), size_t(n)}));                      \
+				for (int64_t i = 0; i < m * n; ++i) {                                              \
+					if (result.storage()[i] != SCALAR(op(i, product[i]))) return false;            \
+				}                                                                                  \
+				return true;                                                                       \
+			};                                                                                     \
+                                                                                                   \
+			/* Broadcast bias and scalar operands, evaluated in the constructor and operator= */   \
+			lrc::Array<SCALAR, DEVICE> fused = lrc::abs(lrc::matmul(a, b) + bias) * SCALAR(2);     \
+			REQUIRE(check(fused, [&](int64_t i, SCALAR val) {                                      \
+				const SCALAR sum = val + bias.storage()[i % n];                                    \
+				return (sum < 0 ? -sum : sum) * 2;                                                 \
+			}));                                                                                   \
+			fused = other - lrc::matmul(a, b);                                                     \
+			REQUIRE(                                                                               \
+			  check(fused, [&](int64_t i, SCALAR val) { return other.storage()[i] - val; }));      \
+                                                                                                   \
+			/* The destination is read by the epilogue, so it is not fused */                      \
+			lrc::Array<SCALAR, DEVICE> acc = other;                                                \
+			acc							   = lrc::matmul(a, b) + acc;                              \
+			REQUIRE(check(acc, [&](int64_t i, SCALAR val) { return val + other.storage()[i]; }));  \
+                                                                                                   \
+			/* More than one product */                                                            \
+			lrc::Array<SCALAR, DEVICE> twice = lrc::matmul(a, b) + lrc::matmul(a, b);              \
+			REQUIRE(check(twice, [&](int64_t, SCALAR val) { return val + val; }));                 \
+                                                                                                   \
+			/* Element access */                                                                   \
+			auto lazy = lrc::matmul(a, b) + bias;                                                  \
+			REQUIRE(lazy.scalar(m * n - 1) == product[m * n - 1] + bias.storage()[n - 1]);         \
+		}                                                                                          \
+                                                                                                   \
+		/* Batched products have the epilogue applied to each matrix */                            \
+		lrc::Array<SCALAR, DEVICE> stackA(ShapeType({5, 3, 4}));                                   \
+		lrc::Array<SCALAR, DEVICE> stackB(ShapeType({5, 4, 6}));                                   \
+		fill(stackA, 3);                                                                           \
+		fill(stackB, 5);                                                                           \
+		lrc::Array<SCALAR, DEVICE> batched = lrc::matmul(stackA, stackB) + SCALAR(1);              \
+		lrc::Array<SCALAR, DEVICE> product = lrc::matmul(stackA, stackB);                          \
+		for (int64_t i = 0; i < 5 * 3 * 6; ++i) {                                                  \
+			REQUIRE(batched.storage()[i] == product.storage()[i] + SCALAR(1));                     \
+		}                                                                                          \
+                                                                                                   \
+		/* The destination is an operand of the product, so it is not fused */                     \
+		for (int64_t size : {6, 70}) {                                                             \
+			lrc::Array<SCALAR, DEVICE> x(ShapeType({size_t(size), size_t(size)}));                 \
+			lrc::Array<SCALAR, DEVICE> w(ShapeType({size_t(size), size_t(size)}));                 \
+			lrc::Array<SCALAR, DEVICE> offset(ShapeType({size_t(size)}));                          \
+			fill(x, 3);                                                                            \
+			fill(w, 5);                                                                            \
+			fill(offset, 2);                                                                       \
+			auto expected =                                                                        \
+			  referenceMatmul(x.storage().begin(), w.storage().begin(), size, size, size);         \
+			for (int64_t i = 0; i < size * size; ++i) {                                            \
+				const SCALAR sum = expected[i] + offset.storage()[i % size];                       \
+				expected[i]		 = sum < 0 ? -sum : sum;                                           \
+			}                                                                                      \
+			x = lrc::abs(lrc::matmul(x, w) + offset);                                              \
+			bool valid = true;                                                                     \
+			for (int64_t i = 0; i < size * size; ++i) {                                            \
+				valid = valid && x.storage()[i] == expected[i];                                    \
+			}                                                                                      \
+			REQUIRE(valid);                                                                        \
+		}                                                                                          \
+                                                                                                   \
+		/* Transpositions are evaluated before the element-wise operations */                      \
+		lrc::Array<SCALAR, DEVICE> matrix(ShapeType({4, 3}));                                      \
+		lrc::Array<SCALAR, DEVICE> matrixT(ShapeType({3, 4}));                                     \
+		fill(matrix, 1);                                                                           \
+		fill(matrixT, 2);                                                                          \
+		lrc::Array<SCALAR, DEVICE> transposed = lrc::transpose(matrix) + matrixT;                  \
+		for (int64_t i = 0; i < 3; ++i) {                                                          \
+			for (int64_t j = 0; j < 4; ++j) {                                                      \
+				REQUIRE(transposed.storage()[i * 4 + j] ==                                         \
+						matrix.storage()[j * 3 + i] + matrixT.storage()[i * 4 + j]);               \
+			}                                                                                      \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Matmul Epilogue -- int32_t CPU", "[matmul]") {
+	TEST_MATMUL_EPILOGUE(int32_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Matmul Epilogue -- float CPU", "[matmul]") {
+	TEST_MATMUL_EPILOGUE(float, lrc::device::CPU);
+}
+
+TEST_CASE("Test Matmul Epilogue -- double CPU", "[matmul]") {
+	TEST_MATMUL_EPILOGUE(double, lrc::device::CPU);
+}
+
+// The packed GEMM is only used by linalg::gemm when no BLAS library is available, so it is also
+// tested directly
+#define TEST_PACKED_GEMM(SCALAR)                                                                   \
+	SECTION(fmt::format("Test Packed GEMM [{}]", STRINGIFY(SCALAR))) {                             \
+		/* Sizes either side of the micro-kernel and block sizes */                                \
+		for (auto [m, n, k] : std::vector<std::array<int64_t, 3>>({{1, 1, 1},                      \
+																   {5, 7, 3},                      \
+																   {6, 16, 8},                     \
+																   {37, 41, 300},                  \
+																   {200, 3, 1100},                 \
+																   {130, 270, 64}})) {             \
+			for (int config = 0; config < 8; ++config) {                                           \
+				const bool transA = config & 1, transB = config & 2, parallel = config & 4;        \
+				std::vector<SCALAR> a(m * k), b(k * n), c(m * n);                                  \
+				for (size_t i = 0; i < a.size(); ++i) { a[i] = SCALAR(int64_t(i * 3) % 7 - 3); }   \
+				for (size_t i = 0; i < b.size(); ++i) { b[i] = SCALAR(int64_t(i * 5) % 7 - 3); }   \
+				for (size_t i = 0; i < c.size(); ++i) { c[i] = SCALAR(int64_t(i) % 5); }           \
+                                                                                                   \
+				auto expected = referenceMatmul(a.data(), b.data(), m, n, k, transA, transB);      \
+				for (size_t i = 0; i < c.size(); ++i) { expected[i] = 2 * expected[i] - c[i]; }    \
+                                                                                                   \
+				lrc::detail::packedGemm<SCALAR>(transA,                                            \
+												transB,                                            \
+												m,                                                 \
+												n,                                                 \
+												k,                                                 \
+												2,                                                 \
+												a.data(),                                          \
+												transA ? m : k,                                    \
+												b.data(),                                          \
+												transB ? k : n,                                    \
+												-1,                                                \
+												c.data(),                                          \
+												n,                                                 \
+												parallel);                                         \
+				REQUIRE(c == expected);                                                            \
+			}                                                                                      \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Packed GEMM -- float", "[matmul]") { TEST_PACKED_GEMM(float); }
+
+TEST_CASE("Test Packed GEMM -- double", "[matmul]") { TEST_PACKED_GEMM(double); }
+
+TEST_CASE("Benchmark Matmul", "[matmul]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	for (size_t size : {64, 256, 1024}) {
+		lrc::Array<float> a(ShapeType({size, size}), 1.0f);
+		lrc::Array<float> b(ShapeType({size, size}), 2.0f);
+		BENCHMARK(fmt::format("Matmul {0}x{0}", size)) { return lrc::matmul(a, b).eval(); };
+		BENCHMARK(fmt::format("Matmul {0}x{0} (transposed)", size)) {
+			return lrc::matmul(a, lrc::transpose(b)).eval();
+		};
+		BENCHMARK(fmt::format("Matmul {0}x{0} + bias (fused)", size)) {
+			lrc::Array<float> c = lrc::abs(lrc::matmul(a, b) + a);
+			return c;
+		};
+		BENCHMARK(fmt::format("Packed GEMM {0}x{0}", size)) {
+			lrc::Array<float> c(ShapeType({size, size}));
+			lrc::detail::packedGemm<float>(false,
+										   false,
+										   size,
+										   size,
+										   size,
+										   1,
+										   a.storage().begin(),
+										   size,
+										   b.storage().begin(),
+										   size,
+										   0,
+										   c.storage().begin(),
+										   size,
+										   lrc::detail::gemmShouldParallelise(size, size));
+			return c;
+		};
+	}
+
+	lrc::Array<float> stackA(ShapeType({4096, 16, 16}), 1.0f);
+	lrc::Array<float> stackB(ShapeType({4096, 16, 16}), 2.0f);
+	BENCHMARK("Batched Matmul 4096x16x16") { return lrc::matmul(stackA, stackB).eval(); };
+}
@@ -0,0 +1,134 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+#define TEST_FULL_REDUCTIONS(SCALAR, DEVICE)                                                       \
+	SECTION(                                                                                       \
+	  fmt::format("Test Full Reductions [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {       \
+		/* Sizes either side of the packet width and the multithreading threshold */               \
+		for (int64_t size : {1, 3, 37, 1021, 100003}) {                                            \
+			lrc::Array<SCALAR, DEVICE>::ShapeType shape({size});                                   \
+			lrc::Array<SCALAR, DEVICE> testA(shape);                                               \
+			lrc::Array<SCALAR, DEVICE> testB(shape);                                               \
+                                                                                                   \
+			SCALAR sum = 0, dot = 0, prod = 1;                                                     \
+			SCALAR min = std::numeric_limits<SCALAR>::max();                                       \
+			SCALAR max = std::numeric_limits<SCALAR>::lowest();                                    \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				testA[i] = SCALAR((i * 7) % 13) - SCALAR(5);                                       \
+				testB[i] = SCALAR(i % 3 == 0 ? -1 : 1);                                            \
+                                                                                                   \
+				sum += testA.scalar(i);                                                            \
+				dot += testA.scalar(i) * testB.scalar(i);                                          \
+				prod *= testB.scalar(i);                                                           \
+				min = testA.scalar(i) < min ? testA.scalar(i) : min;                               \
+				max = testA.scalar(i) > max ? testA.scalar(i) : max;                               \
+			}                                                                                      \
+                                                                                                   \
+			REQUIRE(lrc::sum(testA) == sum);                                                       \
+			REQUIRE(lrc::sum(testA * testB) == dot);                                               \
+			REQUIRE(lrc::prod(testB) == prod);                                                     \
+			REQUIRE(lrc::min(testA) == min);                                                       \
+			REQUIRE(lrc::max(testA) == max);                                                       \
+			REQUIRE(lrc::min(testA + testB) <= lrc::max(testA + testB));                           \
+                                                                                                   \
+			using MeanType = decltype(lrc::mean(testA));                                           \
+			REQUIRE(lrc::mean(testA) == static_cast<MeanType>(sum) / static_cast<MeanType>(size)); \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_AXIS_REDUCTIONS(SCALAR, DEVICE)                                                       \
+	SECTION(                                                                                       \
+	  fmt::format("Test Axis Reductions [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {       \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		/* Prime-dimensioned to force wrapping. The second shape is tall enough that reducing */   \
+		/* axis 0 also splits the reduced axis between threads */                                  \
+		for (ShapeType shape : {ShapeType({7, 37, 41}), ShapeType({2003, 5, 3})}) {                \
+			lrc::Array<SCALAR, DEVICE> testA(shape);                                               \
+			lrc::Array<SCALAR, DEVICE> testB(shape);                                               \
+                                                                                                   \
+			for (int64_t i = 0; i < static_cast<int64_t>(shape.size()); ++i) {                     \
+				testA.storage()[i] = SCALAR((i * 7) % 13) - SCALAR(5);                             \
+				testB.storage()[i] = SCALAR(i % 3);                                                \
+			}                                                                                      \
+                                                                                                   \
+			lrc::Stride<size_t, 32> stride(shape);                                                 \
+			for (int64_t axis = 0; axis < 3; ++axis) {                                             \
+				auto sumResult = lrc::sum(testA * testB, axis);                                    \
+				auto maxResult = lrc::max(testA, axis - 3);                                        \
+                                                                                                   \
+				ShapeType expectedShape = ShapeType::zeros(2);                                     \
+				for (int64_t i = 0, j = 0; i < 3; ++i) {                                           \
+					if (i != axis) expectedShape[j++] = shape[i];                                  \
+				}                                                                                  \
+				REQUIRE(sumResult.shape() == expectedShape);                                       \
+				REQUIRE(maxResult.shape() == expectedShape);                                       \
+                                                                                                   \
+				const size_t length = shape[axis];                                                 \
+				const size_t inner	= stride[axis];                                                \
+				const size_t outer	= shape.size() / (length * inner);                             \
+                                                                                                   \
+				bool valid = true;                                                                 \
+				for (size_t o = 0; o < outer; ++o) {                                               \
+					for (size_t i = 0; i < inner; ++i) {                                           \
+						SCALAR sum = 0;                                                            \
+						SCALAR max = std::numeric_limits<SCALAR>::lowest();                        \
+						for (size_t j = 0; j < length; ++j) {                                      \
+							const size_t index = o * length * inner + j * inner + i;               \
+							sum += testA.scalar(index) * testB.scalar(index);                      \
+							max = testA.scalar(index) > max ? testA.scalar(index) : max;           \
+						}                                                                          \
+                                                                                                   \
+						if (sumResult.scalar(o * inner + i) != sum ||                              \
+							maxResult.scalar(o * inner + i) != max) {                              \
+							REQUIRE(sumResult.scalar(o * inner + i) == sum);                       \
+							REQUIRE(maxResult.scalar(o * inner + i) == max);                       \
+							valid = false;                                                         \
+						}                                                                          \
+					}                                                                              \
+				}                                                                                  \
+				REQUIRE(valid);                                                                    \
+			}                                                                                      \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Reductions -- int32_t CPU", "[reductions]") {
+	TEST_FULL_REDUCTIONS(int32_t, lrc::device::CPU);
+	TEST_AXIS_REDUCTIONS(int32_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Reductions -- int64_t CPU", "[reductions]") {
+	TEST_FULL_REDUCTIONS(int64_t, lrc::device::CPU);
+	TEST_AXIS_REDUCTIONS(int64_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Reductions -- float CPU", "[reductions]") {
+	TEST_FULL_REDUCTIONS(float, lrc::device::CPU);
+	TEST_AXIS_REDUCTIONS(float, lrc::device::CPU);
+}
+
+TEST_CASE("Test Reductions -- double CPU", "[reductions]") {
+	TEST_FULL_REDUCTIONS(double, lrc::device::CPU);
+	TEST_AXIS_REDUCTIONS(double, lrc::device::CPU);
+}
+
+TEST_CASE("Benchmark Reductions", "[reductions]") {
+	lrc::Array<float> a(lrc::Array<float>::ShapeType({1000, 1000}));
+	lrc::Array<float> b(lrc::Array<float>::ShapeType({1000, 1000}));
+
+	BENCHMARK("sum(a)") { return lrc::sum(a); };
+	BENCHMARK("sum(a * b)") { return lrc::sum(a * b); };
+	BENCHMARK("max(a)") { return lrc::max(a); };
+	BENCHMARK("sum(a, 0)") { return lrc::sum(a, 0); };
+	BENCHMARK("sum(a, 1)") { return lrc::sum(a, 1); };
+
+	lrc::Array<float> tall(lrc::Array<float>::ShapeType({1000000, 4}));
+	BENCHMARK("sum(tall, 0)") { return lrc::sum(tall, 0); };
+}
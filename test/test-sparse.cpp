@@ -0,0 +1,170 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+// Build the COO triplets of a rows x cols matrix with a deterministic sparsity pattern. Row 0 is
+// dense, so the rows have very different numbers of nonzero elements, and every fifth row is
+// empty. Each triplet is repeated once in reverse order, so the duplicates must be summed.
+template<typename Scalar>
+void sparseTriplets(int64_t rows, int64_t cols, std::vector<int64_t> &rowIndices,
+					std::vector<int64_t> &colIndices, std::vector<Scalar> &values) {
+	for (int64_t row = 0; row < rows; ++row) {
+		if (row % 5 == 4) continue;
+		for (int64_t col = 0; col < cols; ++col) {
+			if (row != 0 && (row * 7 + col * 3) % 11 != 0) continue;
+			rowIndices.push_back(row);
+			colIndices.push_back(col);
+			values.push_back(Scalar((row + col) % 5) - Scalar(2));
+		}
+	}
+
+	const size_t count = values.size();
+	for (size_t i = count; i > 0; --i) {
+		rowIndices.push_back(rowIndices[i - 1]);
+		colIndices.push_back(colIndices[i - 1]);
+		values.push_back(Scalar(1));
+	}
+}
+
+#define TEST_SPARSE(SCALAR)                                                                        \
+	SECTION(fmt::format("Test SparseArray [{}]", STRINGIFY(SCALAR))) {                             \
+		using ShapeType = lrc::Array<SCALAR>::ShapeType;                                           \
+                                                                                                   \
+		/* Unsorted triplets with duplicates and an empty row */                                   \
+		lrc::SparseArray<SCALAR> small(                                                            \
+		  ShapeType({3, 4}), {2, 0, 2, 0, 2}, {3, 1, 0, 1, 3}, {1, 2, 3, 4, 5});                   \
+		REQUIRE(small.rows() == 3);                                                                \
+		REQUIRE(small.cols() == 4);                                                                \
+		REQUIRE(small.nnz() == 3);                                                                 \
+		REQUIRE(small.rowOffsets() == std::vector<int64_t>({0, 1, 1, 3}));                         \
+		REQUIRE(small.columnIndices() == std::vector<int64_t>({1, 0, 3}));                         \
+		REQUIRE(small.values() == std::vector<SCALAR>({6, 3, 6}));                                 \
+		REQUIRE(small.get(0, 1) == 6);                                                             \
+		REQUIRE(small.get(1, 2) == 0);                                                             \
+		REQUIRE(small.get(2, 3) == 6);                                                             \
+                                                                                                   \
+		auto dense = small.toDense();                                                              \
+		REQUIRE(dense.shape() == ShapeType({3, 4}));                                               \
+		REQUIRE(dense.storage()[1] == 6);                                                          \
+		REQUIRE(dense.storage()[8] == 3);                                                          \
+		REQUIRE(dense.storage()[5] == 0);                                                          \
+                                                                                                   \
+		auto roundTrip = lrc::SparseArray<SCALAR>::fromDense(dense);                               \
+		REQUIRE(roundTrip.rowOffsets() == small.rowOffsets());                                     \
+		REQUIRE(roundTrip.columnIndices() == small.columnIndices());                               \
+		REQUIRE(roundTrip.values() == small.values());                                             \
+                                                                                                   \
+		/* Sizes either side of the multithreading threshold */                                    \
+		for (auto [rows, cols] : std::vector<std::array<int64_t, 2>>({{7, 5}, {600, 450}})) {      \
+			std::vector<int64_t> rowIndices, colIndices;                                           \
+			std::vector<SCALAR> values;                                                            \
+			sparseTriplets(rows, cols, rowIndices, colIndices, values);                            \
+			lrc::SparseArray<SCALAR> matrix(                                                       \
+			  ShapeType({size_t(rows), size_t(cols)}), rowIndices, colIndices, values);            \
+			auto matrixDense = matrix.toDense();                                                   \
+			const SCALAR *a	 = matrixDense.storage().begin();                                      \
+                                                                                                   \
+			lrc::Array<SCALAR> x(ShapeType({size_t(cols)}));                                       \
+			for (int64_t i = 0; i < cols; ++i) { x.storage()[i] = SCALAR(i % 7) - SCALAR(3); }    \
+                                                                                                   \
+			lrc::Array<SCALAR> y = lrc::matmul(matrix, x);                                         \
+			REQUIRE(y.shape() == ShapeType({size_t(rows)}));                                       \
+			bool spmvMatches = true;                                                               \
+			for (int64_t row = 0; row < rows; ++row) {                                             \
+				SCALAR sum(0);                                                                     \
+				for (int64_t col = 0; col < cols; ++col) {                                         \
+					sum += a[row * cols + col] * x.storage()[col];                                 \
+				}                                                                                  \
+				spmvMatches &= y.storage()[row] == sum;                                            \
+			}                                                                                      \
+			REQUIRE(spmvMatches);                                                                  \
+                                                                                                   \
+			/* An odd number of columns exercises the scalar tail of the SpMM kernel */            \
+			const int64_t n = 13;                                                                  \
+			lrc::Array<SCALAR> b(ShapeType({size_t(cols), size_t(n)}));                            \
+			for (int64_t i = 0; i < cols * n; ++i) { b.storage()[i] = SCALAR(i % 5) - SCALAR(2); } \
+                                                                                                   \
+			lrc::Array<SCALAR> c = lrc::matmul(matrix, b);                                         \
+			REQUIRE(c.shape() == ShapeType({size_t(rows), size_t(n)}));                            \
+			lrc::Array<SCALAR> expected = lrc::matmul(matrixDense, b);                             \
+			REQUIRE(c.storage()[0] == expected.storage()[0]);                                      \
+			bool spmmMatches = true;                                                               \
+			for (int64_t i = 0; i < rows * n; ++i) {                                               \
+				spmmMatches &= c.storage()[i] == expected.storage()[i];                            \
+			}                                                                                      \
+			REQUIRE(spmmMatches);                                                                  \
+                                                                                                   \
+			/* Dense operands which are expressions are evaluated first */                         \
+			lrc::Array<SCALAR> cT = lrc::matmul(matrix, lrc::transpose(lrc::transpose(b)));        \
+			REQUIRE(cT.storage()[rows * n - 1] == expected.storage()[rows * n - 1]);               \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test SparseArray -- float", "[sparse]") { TEST_SPARSE(float); }
+
+TEST_CASE("Test SparseArray -- double", "[sparse]") { TEST_SPARSE(double); }
+
+// Never passed to a sparse BLAS library, so this always uses LibRapid's own kernels
+TEST_CASE("Test SparseArray -- int32_t", "[sparse]") { TEST_SPARSE(int32_t); }
+
+TEST_CASE("Test Sparse BLAS Dispatch", "[sparse]") {
+	REQUIRE(lrc::detail::isSparseBlasType<float, int>);
+	REQUIRE(lrc::detail::isSparseBlasType<double, long>);
+	REQUIRE_FALSE(lrc::detail::isSparseBlasType<int32_t, int>);
+	REQUIRE_FALSE(lrc::detail::isSparseBlasType<double, uint32_t>);
+	REQUIRE_FALSE(lrc::detail::isSparseBlasType<lrc::Complex<double>, int>);
+}
+
+TEST_CASE("Test Sparse Row Partitioning", "[sparse]") {
+	// Row 0 holds half of the nonzero elements, so it should be given a thread to itself
+	std::vector<int64_t> rowOffsets = {0};
+	for (int64_t row = 0; row < 1000; ++row) {
+		rowOffsets.push_back(rowOffsets.back() + (row == 0 ? 1000 : 1));
+	}
+
+	const auto bounds = lrc::detail::partitionSparseRows(rowOffsets.data(), 1000, 4);
+	REQUIRE(bounds.size() == 5);
+	REQUIRE(bounds[0] == 0);
+	REQUIRE(bounds[1] == 1);
+	REQUIRE(bounds[4] == 1000);
+	for (size_t i = 1; i < bounds.size(); ++i) { REQUIRE(bounds[i - 1] <= bounds[i]); }
+
+	// Each of the remaining threads gets a similar number of rows
+	REQUIRE(bounds[2] - bounds[1] > 300);
+	REQUIRE(bounds[3] - bounds[2] > 300);
+	REQUIRE(bounds[4] - bounds[3] > 300);
+}
+
+TEST_CASE("Benchmark SparseArray", "[sparse]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	for (int64_t size : {10000, 100000}) {
+		// Roughly 10 nonzero elements per row
+		std::vector<int64_t> rowIndices, colIndices;
+		std::vector<float> values;
+		for (int64_t row = 0; row < size; ++row) {
+			for (int64_t i = 0; i < 10; ++i) {
+				rowIndices.push_back(row);
+				colIndices.push_back((row * 7919 + i * 104729) % size);
+				values.push_back(1.0f);
+			}
+		}
+
+		BENCHMARK(fmt::format("SparseArray from COO {0}x{0}", size)) {
+			return lrc::SparseArray<float>(
+			  ShapeType({size_t(size), size_t(size)}), rowIndices, colIndices, values);
+		};
+
+		lrc::SparseArray<float> matrix(
+		  ShapeType({size_t(size), size_t(size)}), rowIndices, colIndices, values);
+		lrc::Array<float> x(ShapeType({size_t(size)}), 1.0f);
+		lrc::Array<float> b(ShapeType({size_t(size), size_t(16)}), 1.0f);
+
+		BENCHMARK(fmt::format("SpMV {0}x{0}", size)) { return lrc::matmul(matrix, x); };
+		BENCHMARK(fmt::format("SpMM {0}x{0} x 16", size)) { return lrc::matmul(matrix, b); };
+	}
+}
@@ -130,6 +130,412 @@ namespace lrc = librapid;
 		return storage.size();                                                                     \
 	}
 
+TEST_CASE("Test Storage Alignment", "[storage]") {
+	// Every allocation is aligned to LIBRAPID_MEM_ALIGN bytes
+	for (size_t size : {1, 3, 17, 1000}) {
+		lrc::Storage<float> floatStorage(size);
+		lrc::Storage<double> doubleStorage(size, 1);
+		lrc::Storage<int8_t> byteStorage(size);
+		REQUIRE(lrc::detail::isAligned(floatStorage.begin(), LIBRAPID_MEM_ALIGN));
+		REQUIRE(lrc::detail::isAligned(doubleStorage.begin(), LIBRAPID_MEM_ALIGN));
+		REQUIRE(lrc::detail::isAligned(byteStorage.begin(), LIBRAPID_MEM_ALIGN));
+
+		auto copied = doubleStorage;
+		REQUIRE(lrc::detail::isAligned(copied.begin(), LIBRAPID_MEM_ALIGN));
+	}
+
+	lrc::FixedStorage<float, 3, 5> fixedStorage;
+	REQUIRE(lrc::detail::isAligned(fixedStorage.begin(), LIBRAPID_MEM_ALIGN));
+
+	// The number of elements before the first packet-aligned element
+	constexpr int64_t packetWidth = lrc::typetraits::TypeInfo<float>::packetWidth;
+	alignas(LIBRAPID_MEM_ALIGN) float buffer[64];
+	REQUIRE(lrc::detail::alignedHead(buffer, 64) == 0);
+	for (int64_t offset = 1; offset < packetWidth; ++offset) {
+		REQUIRE(lrc::detail::alignedHead(buffer + offset, 64) == packetWidth - offset);
+		REQUIRE(lrc::detail::alignedHead(buffer + offset, 1) == 1);
+	}
+
+	// Assignment to unaligned memory assigns the unaligned head and tail individually
+	using ShapeType = lrc::Array<float>::ShapeType;
+	for (int64_t offset = 0; offset < 4; ++offset) {
+		for (int64_t size : {1, 7, 33, 61}) {
+			lrc::Array<float> a(ShapeType({size_t(size)}));
+			lrc::Array<float> b(ShapeType({size_t(size)}));
+			for (int64_t i = 0; i < size; ++i) {
+				a.storage()[i] = float(i);
+				b.storage()[i] = float(i * 2);
+			}
+
+			alignas(LIBRAPID_MEM_ALIGN) float dst[68];
+			lrc::Array<float> c(ShapeType({size_t(size)}));
+			c.storage() = lrc::Storage<float>(dst + offset, dst + offset + size, false);
+			c			= a + b;
+			REQUIRE(c.storage().begin() == dst + offset);
+			for (int64_t i = 0; i < size; ++i) { REQUIRE(dst[offset + i] == float(i * 3)); }
+
+			lrc::detail::assignParallel(c, a * b);
+			for (int64_t i = 0; i < size; ++i) { REQUIRE(dst[offset + i] == float(i * i * 2)); }
+		}
+	}
+}
+
+TEST_CASE("Test Storage<T, CachingAllocator<T>>", "[storage]") {
+	using CachedStorage = lrc::Storage<double, lrc::CachingAllocator<double>>;
+	lrc::memoryPool::trim();
+	lrc::memoryPool::resetStats();
+
+	// Freed blocks are reused by later allocations of the same size class
+	double *first;
+	{
+		CachedStorage storage(1000, 1.5);
+		first = storage.begin();
+		REQUIRE(lrc::detail::isAligned(first, LIBRAPID_MEM_ALIGN));
+		REQUIRE(lrc::memoryPool::stats().bytesInUse >= int64_t(1000 * sizeof(double)));
+	}
+	REQUIRE(lrc::memoryPool::stats().bytesInUse == 0);
+	REQUIRE(lrc::memoryPool::stats().bytesCached >= int64_t(1000 * sizeof(double)));
+	{
+		CachedStorage storage(990);
+		REQUIRE(storage.begin() == first);
+	}
+
+	auto stats = lrc::memoryPool::stats();
+	REQUIRE(stats.allocations == 2);
+	REQUIRE(stats.cacheHits == 1);
+	REQUIRE(stats.peakBytesInUse >= int64_t(1000 * sizeof(double)));
+
+	lrc::memoryPool::trim();
+	REQUIRE(lrc::memoryPool::stats().bytesCached == 0);
+	REQUIRE(lrc::memoryPool::stats().bytesFromSystem == 0);
+
+	// With no cache, blocks go straight back to the system, except inside an Arena
+	int64_t prevCacheSize			 = lrc::global::memoryPoolCacheSize;
+	lrc::global::memoryPoolCacheSize = 0;
+	{ CachedStorage storage(1000); }
+	REQUIRE(lrc::memoryPool::stats().bytesCached == 0);
+	{
+		lrc::memoryPool::Arena arena;
+		for (int64_t i = 0; i < 4; ++i) { CachedStorage storage(1000); }
+		REQUIRE(lrc::memoryPool::stats().bytesCached > 0);
+	}
+	REQUIRE(lrc::memoryPool::stats().bytesCached == 0);
+	lrc::global::memoryPoolCacheSize = prevCacheSize;
+
+	// Arrays can use the caching allocator for their storage
+	using ShapeType = lrc::Array<double>::ShapeType;
+	lrc::Array<double, CachedStorage> a(ShapeType({100}), 2);
+	lrc::Array<double, CachedStorage> b(ShapeType({100}), 3);
+	lrc::Array<double, CachedStorage> c = a * b + a;
+	for (int64_t i = 0; i < 100; ++i) { REQUIRE(c.storage()[i] == 8); }
+
+	// Operands which must be evaluated before a matrix multiplication are evaluated into the
+	// pool, and the same block is reused when the product is repeated
+	lrc::Array<double> m(ShapeType({16, 16}), 1);
+	lrc::Array<double> product = lrc::matmul(m + m, m);
+	lrc::memoryPool::resetStats();
+	product = lrc::matmul(m + m, m);
+	REQUIRE(lrc::memoryPool::stats().allocations == 1);
+	REQUIRE(lrc::memoryPool::stats().cacheHits == 1);
+	REQUIRE(lrc::memoryPool::stats().bytesInUse == 0);
+	for (int64_t i = 0; i < 256; ++i) { REQUIRE(product.storage()[i] == 32); }
+}
+
+/// Restores the NUMA topology and the threading globals when it goes out of scope, so a failed
+/// REQUIRE cannot leave them changed for later tests
+struct NumaStateGuard {
+	lrc::numa::Topology topology = lrc::numa::topology();
+	int64_t numThreads			 = lrc::global::numThreads;
+	int64_t multithreadThreshold = lrc::global::multithreadThreshold;
+
+	~NumaStateGuard() {
+		lrc::numa::setTopology(topology);
+		lrc::global::numThreads			  = numThreads;
+		lrc::global::multithreadThreshold = multithreadThreshold;
+	}
+};
+
+/// Return the thread which processes the element at byte \p offset of an array of
+/// \p elements doubles, under the static partition used by assignParallel
+int64_t numaOwner(int64_t offset, int64_t elements, int64_t threads) {
+	const int64_t element = offset / int64_t(sizeof(double));
+	int64_t thread		  = 0;
+	while (elements * (thread + 1) / threads <= element) ++thread;
+	return thread;
+}
+
+TEST_CASE("Test Storage<T, NumaAllocator<T>>", "[storage]") {
+	NumaStateGuard guard;
+	const bool realNuma = lrc::numa::detectTopology().numNodes() >= 2;
+
+	// Place a fake two-node topology over a single-node machine
+	lrc::numa::Topology fake;
+	fake.nodes = {{0, {0, 1}}, {1, {2, 3}}};
+	lrc::numa::setTopology(fake);
+	REQUIRE(lrc::numa::topology().numNodes() == 2);
+
+	// Threads are split into contiguous blocks across the nodes
+	REQUIRE(lrc::numa::threadNode(0, 4) == 0);
+	REQUIRE(lrc::numa::threadNode(1, 4) == 0);
+	REQUIRE(lrc::numa::threadNode(2, 4) == 1);
+	REQUIRE(lrc::numa::threadNode(3, 4) == 1);
+	REQUIRE(lrc::numa::threadNode(0, 1) == 0);
+	REQUIRE(lrc::numa::threadNode(5, 6) == 1);
+
+	lrc::global::multithreadThreshold = 1000;
+	lrc::global::numThreads			  = 4;
+
+	// Each page is first touched by the thread which processes the elements starting in it
+	constexpr int64_t elements = 100000;
+	constexpr int64_t bytes	   = elements * sizeof(double);
+	constexpr int64_t pages	   = (bytes + 4095) / 4096;
+	void *memory			   = lrc::numa::detail::allocate(bytes, 4096);
+	std::vector<int64_t> touchedBy(pages, -1);
+	lrc::numa::detail::firstTouch(memory, bytes, sizeof(double), touchedBy.data());
+
+	bool valid = true;
+	for (int64_t page = 0; page < pages; ++page) {
+#if defined(LIBRAPID_HAS_OMP)
+		const int64_t expected = numaOwner(page * 4096, elements, 4);
+#else
+		const int64_t expected = 0;
+#endif
+		valid = valid && touchedBy[page] == expected;
+	}
+	REQUIRE(valid);
+	lrc::numa::detail::deallocate(memory, bytes, 4096);
+
+	// Interleaving falls back to first-touch placement if the nodes do not exist
+	lrc::Storage<double, lrc::NumaAllocator<double>> firstTouch(elements, 2);
+	lrc::Storage<double, lrc::NumaAllocator<double, lrc::numa::Policy::Interleave>> interleaved(
+	  elements, 3);
+	REQUIRE(lrc::detail::isAligned(firstTouch.begin(), 4096));
+	REQUIRE(lrc::detail::isAligned(interleaved.begin(), 4096));
+	if (!realNuma) { REQUIRE(lrc::numa::detail::interleavedNodes(interleaved.begin()).empty()); }
+
+	for (int64_t i = 0; i < elements; ++i) {
+		valid = valid && firstTouch[i] == 2 && interleaved[i] == 3;
+	}
+	REQUIRE(valid);
+
+	// Two fake nodes which both map to node 0 (which always exists) give a mask the kernel
+	// accepts, so the policy set by mbind can be read back
+	fake.nodes = {{0, {0, 1}}, {0, {2, 3}}};
+	lrc::numa::setTopology(fake);
+	memory			   = lrc::numa::detail::allocate(bytes, 4096);
+	const bool applied = lrc::numa::detail::interleave(memory, bytes);
+	const auto nodes   = lrc::numa::detail::interleavedNodes(memory);
+	if (applied) {
+		REQUIRE(nodes == std::vector<int64_t> {0});
+	} else {
+		REQUIRE(nodes.empty());
+	}
+	lrc::numa::detail::deallocate(memory, bytes, 4096);
+
+	// On a real NUMA machine, check that the pages end up on the nodes of the threads which
+	// touched them, and that interleaving covers every node
+	if (realNuma) {
+		lrc::numa::setTopology(lrc::numa::detectTopology());
+		const auto &topology = lrc::numa::topology();
+		const bool bound	 = lrc::numa::bindThreads();
+
+		memory = lrc::numa::detail::allocate(bytes, 4096);
+		lrc::numa::detail::firstTouch(memory, bytes, sizeof(double), touchedBy.data());
+		for (int64_t page = 0; page < pages && bound; ++page) {
+			const auto *address = static_cast<const char *>(memory) + page * 4096;
+			const int64_t node	= topology.nodes[lrc::numa::threadNode(touchedBy[page], 4)].id;
+			valid				= valid && lrc::numa::detail::pageNode(address) == node;
+		}
+		REQUIRE(valid);
+		lrc::numa::detail::deallocate(memory, bytes, 4096);
+
+		std::vector<int64_t> allNodes;
+		for (const auto &node : topology.nodes) allNodes.push_back(node.id);
+		std::sort(allNodes.begin(), allNodes.end());
+		lrc::Storage<double, lrc::NumaAllocator<double, lrc::numa::Policy::Interleave>> spread(
+		  elements, 4);
+		REQUIRE(lrc::numa::detail::interleavedNodes(spread.begin()) == allNodes);
+	}
+
+	REQUIRE(lrc::numa::detectTopology().numNodes() >= 1);
+}
+
+TEST_CASE("Test Storage<T, HugePageAllocator<T>>", "[storage]") {
+	// Whether huge pages are available depends on the system, so only check that the memory is
+	// usable and that what is reported is plausible
+	constexpr int64_t elements = 3 * lrc::hugePages::pageSize / sizeof(double);
+	lrc::Storage<double, lrc::HugePageAllocator<double>> transparent(elements, 1);
+	lrc::Storage<double, lrc::HugePageAllocator<double, lrc::HugePageMode::Explicit>> explicitPages(
+	  elements, 2);
+	REQUIRE(lrc::detail::isAligned(transparent.begin(), LIBRAPID_MEM_ALIGN));
+	REQUIRE(lrc::detail::isAligned(explicitPages.begin(), LIBRAPID_MEM_ALIGN));
+
+	bool valid = true;
+	for (int64_t i = 0; i < elements; ++i) {
+		valid = valid && transparent[i] == 1 && explicitPages[i] == 2;
+	}
+	REQUIRE(valid);
+
+	const int64_t bytes = elements * sizeof(double);
+	REQUIRE(lrc::hugePages::hugePageBytes(transparent.begin()) >= 0);
+	REQUIRE(lrc::hugePages::hugePageBytes(transparent.begin()) <= bytes);
+	REQUIRE(lrc::hugePages::hugePageBytes(explicitPages.begin()) <= bytes);
+
+	// Small allocations never use huge pages
+	lrc::Storage<double, lrc::HugePageAllocator<double>> small(100);
+	REQUIRE(lrc::hugePages::hugePageBytes(small.begin()) == 0);
+
+	// Huge pages can also be selected globally for the default allocator, and the memory is
+	// still freed correctly after the setting is changed back
+	const int64_t prevThreshold = lrc::global::hugePageThreshold;
+
+	lrc::global::hugePageThreshold = 0;
+	lrc::global::hugePageMode	   = lrc::HugePageMode::Transparent;
+	auto large = std::make_unique<lrc::Storage<double>>(elements, 3);
+	lrc::Storage<double> tiny(100);
+
+	// Over-aligned allocators keep their alignment whether or not huge pages are obtained
+	using OverAligned = lrc::AlignedAllocator<double, 8192>;
+	OverAligned overAligned;
+	double *wide = overAligned.allocate(elements);
+	REQUIRE(lrc::detail::isAligned(wide, 8192));
+	overAligned.deallocate(wide, elements);
+
+	lrc::global::hugePageMode	   = lrc::HugePageMode::None;
+	lrc::global::hugePageThreshold = prevThreshold;
+
+	REQUIRE(lrc::hugePages::hugePageBytes(tiny.begin()) == 0);
+	REQUIRE((*large)[elements - 1] == 3);
+	large.reset();
+}
+
+#if defined(LIBRAPID_LINUX) || defined(LIBRAPID_APPLE)
+TEST_CASE("Test Storage<T, MmapAllocator<T>>", "[storage]") {
+	const std::string path = "test-storage-mmap.bin";
+	using ShapeType		   = lrc::Array<double>::ShapeType;
+	std::remove(path.c_str());
+
+	{
+		// Writable mappings create the file, and expressions can be assigned straight into it
+		auto written = lrc::mapArray<double>(path, ShapeType({40, 25}), lrc::MmapMode::ReadWrite);
+		for (int64_t i = 0; i < 1000; ++i) written.storage()[i] = double(i);
+		written = written * 2 + 1;
+
+		// Copies are held in memory
+		auto copy		  = written;
+		copy.storage()[0] = -1;
+		REQUIRE(written.storage()[0] == 1);
+	}
+
+	{
+		auto readOnly = lrc::mapArray<double>(path);
+		REQUIRE(readOnly.shape() == ShapeType({1000}));
+		lrc::Array<double> result = readOnly + readOnly;
+		for (int64_t i = 0; i < 1000; ++i) { REQUIRE(result.scalar(i) == double(i * 4 + 2)); }
+
+		// Offsets need not be aligned to a page
+		auto offset = lrc::mapArray<double>(
+		  path, ShapeType({10}), lrc::MmapMode::ReadOnly, lrc::MmapAdvice::Random, 990 * 8);
+		REQUIRE(offset.scalar(0) == 990 * 2 + 1);
+		REQUIRE(offset.scalar(9) == 999 * 2 + 1);
+	}
+
+	{
+		// Copy-on-write changes never reach the file
+		auto cow = lrc::mapArray<double>(path, lrc::MmapMode::CopyOnWrite);
+		cow.storage()[0] = 123;
+		REQUIRE(cow.scalar(0) == 123);
+	}
+	REQUIRE(lrc::mapArray<double>(path).scalar(0) == 1);
+
+	// Read-only files must be large enough for the array
+	REQUIRE_THROWS(lrc::mapArray<double>(path, ShapeType({1001})));
+
+	// Offsets which would leave the elements misaligned are rejected
+	REQUIRE_THROWS_AS(lrc::mapArray<double>(
+						path, ShapeType({10}), lrc::MmapMode::ReadOnly, lrc::MmapAdvice::Normal, 3),
+					  std::runtime_error);
+	REQUIRE_THROWS_AS(
+	  lrc::mapArray<double>(path, lrc::MmapMode::ReadOnly, lrc::MmapAdvice::Normal, 4),
+	  std::runtime_error);
+	REQUIRE(lrc::mapArray<float>(path, lrc::MmapMode::ReadOnly, lrc::MmapAdvice::Normal, 4)
+			  .shape() == lrc::Array<float>::ShapeType({1999}));
+	std::remove(path.c_str());
+}
+
+TEST_CASE("Test saveArray and loadArray", "[storage]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	auto array		= lrc::Array<float>(ShapeType({3, 5, 7}));
+	for (int64_t i = 0; i < 105; ++i) array.storage()[i] = float(i) / 4;
+
+	for (const std::string path : {"test-storage-array.lra", "test-storage-array.npy"}) {
+		lrc::saveArray(path, array);
+
+		auto loaded = lrc::loadArray<float>(path);
+		REQUIRE(loaded.shape() == array.shape());
+		for (int64_t i = 0; i < 105; ++i) { REQUIRE(loaded.storage()[i] == float(i) / 4); }
+
+		// The elements are mapped straight from the file, and are suitably aligned
+		REQUIRE(lrc::detail::isAligned(loaded.storage().begin(), LIBRAPID_MEM_ALIGN));
+
+		// The element type must match exactly
+		REQUIRE_THROWS(lrc::loadArray<double>(path));
+		REQUIRE_THROWS(lrc::loadArray<int32_t>(path));
+		std::remove(path.c_str());
+	}
+
+	// The .npy header is exactly what numpy.save() writes
+	lrc::saveArray("test-storage-array.npy", lrc::Array<int32_t>(ShapeType({4}), 7));
+	std::ifstream file("test-storage-array.npy", std::ios::binary);
+	std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	file.close();
+	REQUIRE(contents.size() == 128 + 4 * 4);
+	REQUIRE(contents.substr(0, 8) == std::string("\x93NUMPY\x01\x00", 8));
+	REQUIRE(contents.substr(10, 57) ==
+			"{'descr': '<i4', 'fortran_order': False, 'shape': (4,), }");
+	REQUIRE(contents[127] == '\n');
+	std::remove("test-storage-array.npy");
+}
+
+TEST_CASE("Test assignStreaming and evaluateToFile", "[storage]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+	const int64_t n = 100000;
+
+	{
+		const auto mode = lrc::MmapMode::ReadWrite;
+		auto a			= lrc::mapArray<double>("test-storage-a.bin", ShapeType({n}), mode);
+		auto b			= lrc::mapArray<double>("test-storage-b.bin", ShapeType({n}), mode);
+		for (int64_t i = 0; i < n; ++i) {
+			a.storage()[i] = double(i);
+			b.storage()[i] = double(n - i);
+		}
+	}
+
+	auto a = lrc::mapArray<double>("test-storage-a.bin");
+	auto b = lrc::mapArray<double>("test-storage-b.bin");
+
+	// A tiny budget, so the expression is evaluated in many chunks
+	const int64_t budget = 64 * 1024;
+
+	lrc::Array<double> inMemory(ShapeType({n}));
+	lrc::assignStreaming(inMemory, a * 2 + b, budget);
+	for (int64_t i = 0; i < n; ++i) { REQUIRE(inMemory.scalar(i) == double(n + i)); }
+
+	{
+		auto onDisk = lrc::evaluateToFile(
+		  "test-storage-result.npy", a - b * 3, lrc::ArrayFileFormat::Auto, budget);
+		REQUIRE(onDisk.shape() == ShapeType({n}));
+	}
+
+	auto loaded = lrc::loadArray<double>("test-storage-result.npy");
+	for (int64_t i = 0; i < n; ++i) { REQUIRE(loaded.scalar(i) == double(i - (n - i) * 3)); }
+
+	std::remove("test-storage-a.bin");
+	std::remove("test-storage-b.bin");
+	std::remove("test-storage-result.npy");
+}
+#endif // LIBRAPID_LINUX || LIBRAPID_APPLE
+
 TEST_CASE("Test Storage<T>", "[storage]") {
 	SECTION("Trivially Constructible Storage") {
 		REGISTER_CASES(char);
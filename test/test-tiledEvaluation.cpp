@@ -0,0 +1,115 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+// Evaluate an expression with tiled evaluation forced on or off
+#define EVALUATE_WITH_THRESHOLD(THRESHOLD_, EXPR_)                                                 \
+	[&]() {                                                                                        \
+		const int64_t prevThreshold			  = lrc::global::tiledEvaluationThreshold;             \
+		lrc::global::tiledEvaluationThreshold = THRESHOLD_;                                        \
+		auto result							  = (EXPR_).eval();                                    \
+		lrc::global::tiledEvaluationThreshold = prevThreshold;                                     \
+		return result;                                                                             \
+	}()
+
+#define TEST_TILED_EVALUATION(SCALAR, DEVICE)                                                      \
+	SECTION(                                                                                       \
+	  fmt::format("Test Tiled Evaluation [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {      \
+		/* Sizes either side of the tile size and the multithreading threshold */                  \
+		for (int64_t size : {1, 37, 4099, 100003}) {                                               \
+			using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                               \
+			std::vector<lrc::Array<SCALAR, DEVICE>> arrays;                                        \
+			for (int64_t i = 0; i < 8; ++i) {                                                      \
+				arrays.emplace_back(ShapeType({size}));                                            \
+				for (int64_t j = 0; j < size; ++j) {                                               \
+					arrays[i].storage()[j] = SCALAR((j * (i + 3)) % 17) - SCALAR(8);               \
+				}                                                                                  \
+			}                                                                                      \
+                                                                                                   \
+			auto &a = arrays[0], &b = arrays[1], &c = arrays[2], &d = arrays[3];                   \
+			auto &e = arrays[4], &f = arrays[5], &g = arrays[6], &h = arrays[7];                   \
+			auto expr = (a + b) * (c - d) + e * f - (g + h) * SCALAR(2);                           \
+			REQUIRE(lrc::typetraits::NumArraySources<decltype(expr)>::value == 8);                 \
+                                                                                                   \
+			auto tiled	  = EVALUATE_WITH_THRESHOLD(1, expr);                                      \
+			auto streamed = EVALUATE_WITH_THRESHOLD(1000, expr);                                   \
+                                                                                                   \
+			bool valid = true;                                                                     \
+			for (int64_t i = 0; i < size; ++i) {                                                   \
+				const SCALAR ab		  = a.scalar(i) + b.scalar(i);                                 \
+				const SCALAR sum	  = ab * (c.scalar(i) - d.scalar(i));                          \
+				const SCALAR expected = sum + e.scalar(i) * f.scalar(i) -                          \
+										(g.scalar(i) + h.scalar(i)) * SCALAR(2);                   \
+				if (tiled.scalar(i) != expected || streamed.scalar(i) != expected) {               \
+					REQUIRE(tiled.scalar(i) == expected);                                          \
+					REQUIRE(streamed.scalar(i) == expected);                                       \
+					valid = false;                                                                 \
+				}                                                                                  \
+			}                                                                                      \
+			REQUIRE(valid);                                                                        \
+		}                                                                                          \
+                                                                                                   \
+		/* Broadcast arguments are read in place rather than buffered */                           \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		lrc::Array<SCALAR, DEVICE> matrix(ShapeType({301, 41}));                                   \
+		lrc::Array<SCALAR, DEVICE> row(ShapeType({41}));                                           \
+		lrc::Array<SCALAR, DEVICE> column(ShapeType({301, 1}));                                    \
+		for (int64_t i = 0; i < 301 * 41; ++i) { matrix.storage()[i] = SCALAR(i % 7); }            \
+		for (int64_t i = 0; i < 41; ++i) { row.storage()[i] = SCALAR(i % 5); }                     \
+		for (int64_t i = 0; i < 301; ++i) { column.storage()[i] = SCALAR(i % 3); }                 \
+                                                                                                   \
+		auto broadcast = EVALUATE_WITH_THRESHOLD(                                                  \
+		  1, (matrix + row) * (matrix - column) + row * column - (matrix + row) * column);         \
+		bool broadcastValid = true;                                                                \
+		for (int64_t i = 0; i < 301 * 41; ++i) {                                                   \
+			const SCALAR m = matrix.scalar(i), r = row.scalar(i % 41), c = column.scalar(i / 41);  \
+			const SCALAR expected = (m + r) * (m - c) + r * c - (m + r) * c;                       \
+			if (broadcast.scalar(i) != expected) {                                                 \
+				REQUIRE(broadcast.scalar(i) == expected);                                          \
+				broadcastValid = false;                                                            \
+			}                                                                                      \
+		}                                                                                          \
+		REQUIRE(broadcastValid);                                                                   \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Tiled Evaluation -- int32_t CPU", "[tiled-evaluation]") {
+	TEST_TILED_EVALUATION(int32_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Tiled Evaluation -- float CPU", "[tiled-evaluation]") {
+	TEST_TILED_EVALUATION(float, lrc::device::CPU);
+}
+
+TEST_CASE("Test Tiled Evaluation -- double CPU", "[tiled-evaluation]") {
+	TEST_TILED_EVALUATION(double, lrc::device::CPU);
+}
+
+// Compare tiled and streamed evaluation for expressions reading from an increasing number of
+// arrays. Streamed evaluation wins for shallow expressions, while tiled evaluation wins once the
+// number of arrays exceeds what the cache and prefetchers can keep track of. The crossover point
+// is the best value for global::tiledEvaluationThreshold on the current machine.
+#define BENCHMARK_TILED_EVALUATION(NAME_, EXPR_)                                                   \
+	BENCHMARK(NAME_ " -- streamed") { return EVALUATE_WITH_THRESHOLD(1000, EXPR_); };              \
+	BENCHMARK(NAME_ " -- tiled") { return EVALUATE_WITH_THRESHOLD(1, EXPR_); }
+
+TEST_CASE("Benchmark Tiled Evaluation", "[tiled-evaluation]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	std::vector<lrc::Array<float>> arrays;
+	for (int64_t i = 0; i < 16; ++i) { arrays.emplace_back(ShapeType({1 << 22}), float(i)); }
+	auto &a = arrays[0], &b = arrays[1], &c = arrays[2], &d = arrays[3];
+	auto &e = arrays[4], &f = arrays[5], &g = arrays[6], &h = arrays[7];
+	auto &i = arrays[8], &j = arrays[9], &k = arrays[10], &l = arrays[11];
+	auto &m = arrays[12], &n = arrays[13], &o = arrays[14], &p = arrays[15];
+
+	BENCHMARK_TILED_EVALUATION("2 arrays", a * b);
+	BENCHMARK_TILED_EVALUATION("4 arrays", (a + b) * (c - d));
+	BENCHMARK_TILED_EVALUATION("8 arrays", (a + b) * (c - d) + (e + f) * (g - h));
+	BENCHMARK_TILED_EVALUATION("16 arrays",
+							   (a + b) * (c - d) + (e + f) * (g - h) + (i + j) * (k - l) +
+								 (m + n) * (o - p));
+}
@@ -0,0 +1,119 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+#define TEST_TRANSPOSE(SCALAR, DEVICE)                                                             \
+	SECTION(fmt::format("Test Transpose [{} | {}]", STRINGIFY(SCALAR), STRINGIFY(DEVICE))) {       \
+		using ShapeType = lrc::Array<SCALAR, DEVICE>::ShapeType;                                   \
+		using AxesType	= lrc::Shape<size_t, 32>;                                                  \
+                                                                                                   \
+		/* Matrices either side of the tile size and the multithreading threshold, followed by */  \
+		/* permutations which do and do not move the innermost dimension */                        \
+		std::vector<std::pair<ShapeType, AxesType>> cases = {                                      \
+		  {ShapeType({1, 1}), AxesType({1, 0})},                                                   \
+		  {ShapeType({37, 41}), AxesType({1, 0})},                                                 \
+		  {ShapeType({301, 257}), AxesType({1, 0})},                                               \
+		  {ShapeType({3, 37, 41}), AxesType({0, 2, 1})},                                           \
+		  {ShapeType({3, 37, 41}), AxesType({2, 0, 1})},                                           \
+		  {ShapeType({5, 7, 9, 11}), AxesType({3, 1, 0, 2})},                                      \
+		  {ShapeType({5, 7, 9, 11}), AxesType({1, 0, 2, 3})}};                                     \
+                                                                                                   \
+		for (const auto &[shape, axes] : cases) {                                                  \
+			lrc::Array<SCALAR, DEVICE> testA(shape);                                               \
+			for (int64_t i = 0; i < static_cast<int64_t>(shape.size()); ++i) {                     \
+				testA.storage()[i] = SCALAR(i % 127);                                              \
+			}                                                                                      \
+                                                                                                   \
+			lrc::Array<SCALAR, DEVICE> result = lrc::transpose(testA, axes);                       \
+			lrc::Array<SCALAR, DEVICE> sum	  = lrc::transpose(testA + testA, axes);               \
+			const auto resultShape			  = result.shape();                                    \
+			const lrc::Stride<size_t, 32> stride(shape);                                           \
+                                                                                                   \
+			for (int64_t i = 0; i < static_cast<int64_t>(shape.ndim()); ++i) {                     \
+				REQUIRE(resultShape[i] == shape[axes[i]]);                                         \
+			}                                                                                      \
+                                                                                                   \
+			bool valid = true;                                                                     \
+			for (int64_t i = 0; i < static_cast<int64_t>(shape.size()); ++i) {                     \
+				int64_t index = i, srcIndex = 0;                                                   \
+				for (int64_t d = shape.ndim() - 1; d >= 0; --d) {                                  \
+					srcIndex += (index % resultShape[d]) * stride[axes[d]];                        \
+					index /= resultShape[d];                                                       \
+				}                                                                                  \
+                                                                                                   \
+				const SCALAR expected = testA.scalar(srcIndex);                                    \
+				if (result.scalar(i) != expected || sum.scalar(i) != expected + expected) {        \
+					REQUIRE(result.scalar(i) == expected);                                         \
+					REQUIRE(sum.scalar(i) == expected + expected);                                 \
+					valid = false;                                                                 \
+				}                                                                                  \
+			}                                                                                      \
+			REQUIRE(valid);                                                                        \
+		}                                                                                          \
+                                                                                                   \
+		/* The default permutation reverses the axes */                                            \
+		lrc::Array<SCALAR, DEVICE> matrix(ShapeType({2, 3}));                                      \
+		for (int64_t i = 0; i < 6; ++i) { matrix.storage()[i] = SCALAR(i); }                       \
+		auto transposed = lrc::transpose(matrix).eval();                                           \
+		REQUIRE(transposed.shape() == ShapeType({3, 2}));                                          \
+		REQUIRE(transposed.scalar(1) == SCALAR(3));                                                \
+		REQUIRE(lrc::transpose(matrix).scalar(4) == SCALAR(2));                                    \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Transpose -- int32_t CPU", "[transpose]") {
+	TEST_TRANSPOSE(int32_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Transpose -- int64_t CPU", "[transpose]") {
+	TEST_TRANSPOSE(int64_t, lrc::device::CPU);
+}
+
+TEST_CASE("Test Transpose -- float CPU", "[transpose]") { TEST_TRANSPOSE(float, lrc::device::CPU); }
+
+TEST_CASE("Test Transpose -- double CPU", "[transpose]") {
+	TEST_TRANSPOSE(double, lrc::device::CPU);
+}
+
+TEST_CASE("Test Transpose -- Self Assignment", "[transpose]") {
+	using ShapeType = lrc::Array<double>::ShapeType;
+
+	// Square and non-square matrices, either side of the multithreading threshold
+	for (const auto &shape : {ShapeType({37, 37}), ShapeType({37, 41}), ShapeType({301, 257})}) {
+		const auto rows = static_cast<int64_t>(shape[0]);
+		const auto cols = static_cast<int64_t>(shape[1]);
+		lrc::Array<double> original(shape);
+		for (int64_t i = 0; i < rows * cols; ++i) { original.storage()[i] = double(i); }
+
+		lrc::Array<double> a = original;
+		a					 = lrc::transpose(a);
+		lrc::Array<double> b = original;
+		b					 = lrc::transpose(b) + 1.0;
+		REQUIRE(a.shape() == ShapeType({size_t(cols), size_t(rows)}));
+		REQUIRE(b.shape() == ShapeType({size_t(cols), size_t(rows)}));
+
+		bool valid = true;
+		for (int64_t r = 0; r < cols; ++r) {
+			for (int64_t c = 0; c < rows; ++c) {
+				const double expected = original.storage()[c * cols + r];
+				valid				  = valid && a.storage()[r * rows + c] == expected &&
+						b.storage()[r * rows + c] == expected + 1.0;
+			}
+		}
+		REQUIRE(valid);
+	}
+}
+
+TEST_CASE("Benchmark Transpose", "[transpose]") {
+	using ShapeType = lrc::Array<float>::ShapeType;
+	lrc::Array<float> matrix(ShapeType({4096, 4096}), 1.0f);
+	lrc::Array<float> tensor(ShapeType({64, 256, 256}), 1.0f);
+
+	BENCHMARK("transpose(matrix)") { return lrc::transpose(matrix).eval(); };
+	BENCHMARK("transpose(tensor, {2, 0, 1})") { return lrc::transpose(tensor, {2, 0, 1}).eval(); };
+	BENCHMARK("transpose(tensor, {1, 0, 2})") { return lrc::transpose(tensor, {1, 0, 2}).eval(); };
+}